@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace Nui::Detail
+{
+    /**
+     * @brief Appends the string as a quoted JSON string literal, used by payloads that are written without a json
+     * object.
+     */
+    void appendJsonString(std::string& out, std::string_view str);
+}
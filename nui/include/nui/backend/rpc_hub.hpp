@@ -1,6 +1,10 @@
 #pragma once
 
 #include <nui/window.hpp>
+#include <nui/backend/rpc_stream.hpp>
+#include <nui/backend/rpc_schema_codec.hpp>
+#include <nui/shared/rpc_request_error.hpp>
+#include <nui/shared/rpc_schema.hpp>
 #include <nui/data_structures/selectables_registry.hpp>
 #include <nui/utility/meta/pick_first.hpp>
 #include <nui/shared/on_destroy.hpp>
@@ -8,7 +12,12 @@
 #include <traits/functions.hpp>
 #include <nlohmann/json.hpp>
 #include <fmt/format.h>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -52,7 +61,7 @@ namespace Nui
                 {
                     const auto hi = static_cast<std::uint64_t>(json.at("_u64_hi").get<std::uint32_t>());
                     const auto lo = static_cast<std::uint64_t>(json.at("_u64_lo").get<std::uint32_t>());
-                    const std::uint64_t combined = (hi << u32BitCount) | lo;
+                    std::uint64_t combined = (hi << u32BitCount) | lo;
                     if constexpr (std::is_same_v<Decayed, std::int64_t>)
                         return static_cast<std::int64_t>(combined);
                     else
@@ -105,33 +114,123 @@ namespace Nui
                   typename Traits::FunctionTraits<std::decay_t<FunctionT>>::ReturnType,
                   typename Traits::FunctionTraits<std::decay_t<FunctionT>>::ArgsTuple>
         {};
+
+        class RpcCallBatch;
     }
 
     class RpcHub
     {
       public:
         explicit RpcHub(Window& window);
-        ~RpcHub() = default;
+        ~RpcHub();
         RpcHub(const RpcHub&) = delete;
         RpcHub& operator=(const RpcHub&) = delete;
         RpcHub(RpcHub&&) = delete;
         RpcHub& operator=(RpcHub&&) = delete;
 
-        constexpr static char const* remoteCallScript = R"(
-            (function() {{
-                if (globalThis.nui_rpc.frontend.hasOwnProperty("{0}")) {{
-                    globalThis.nui_rpc.frontend["{0}"]({1});
-                    return;
-                }}
+        /**
+         * @brief Installed once per page load. Calls to the frontend are then only a short dispatch invocation with
+         * the id of the function, instead of a full script that has to be compiled for every call.
+         */
+        constexpr static char const* dispatcherScript = R"(
+            (() => {
+                globalThis.nui_rpc = globalThis.nui_rpc || {frontend: {}, backend: {}, tempId: 0, initialized: false};
+                const functionNames = [];
+                globalThis.nui_rpc.define = (id, name) => {
+                    functionNames[id] = name;
+                };
+                globalThis.nui_rpc.dispatch = (target, args) => {
+                    const name = typeof target === "number" ? functionNames[target] : target;
+                    const frontend = globalThis.nui_rpc.frontend;
+                    if (name !== undefined && frontend.hasOwnProperty(name)) {
+                        frontend[name](args);
+                        return;
+                    }
+
+                    globalThis.nui_rpc.errors = globalThis.nui_rpc.errors || [];
+                    globalThis.nui_rpc.errors.push(`Function ${name === undefined ? target : name} does not exist.`);
+                    if (globalThis.nui_rpc.errors.length > 100) {
+                        globalThis.nui_rpc.errors.shift();
+                    }
+                };
 
-                globalThis.nui_rpc.errors = globalThis.nui_rpc.errors || [];
-                globalThis.nui_rpc.errors.push("Function {0} does not exist.");
-                if (globalThis.nui_rpc.errors.length > 100) {{
-                    globalThis.nui_rpc.errors.shift();
-                }}
-            }})();
+                // Calls that expect a reply register a callback here and pass "reply_<id>" as back channel.
+                const pendingCalls = new Map();
+                let lastCallId = 0;
+                globalThis.nui_rpc.request = (callback, timeout, onTimeout) => {
+                    const id = ++lastCallId;
+                    const entry = {callback: callback, timer: undefined};
+                    if (timeout > 0) {
+                        entry.timer = setTimeout(() => {
+                            pendingCalls.delete(id);
+                            if (onTimeout !== undefined)
+                                onTimeout();
+                        }, timeout);
+                    }
+                    pendingCalls.set(id, entry);
+                    return id;
+                };
+                globalThis.nui_rpc.cancel = (id) => {
+                    const entry = pendingCalls.get(id);
+                    if (entry === undefined)
+                        return false;
+                    clearTimeout(entry.timer);
+                    pendingCalls.delete(id);
+                    return true;
+                };
+                globalThis.nui_rpc.isPending = (id) => pendingCalls.has(id);
+                globalThis.nui_rpc.reply = (id, args) => {
+                    const entry = pendingCalls.get(id);
+                    if (entry === undefined)
+                        return;
+                    clearTimeout(entry.timer);
+                    pendingCalls.delete(id);
+                    entry.callback(args);
+                };
+                globalThis.nui_rpc.requestPromise = (invoke, timeout, signal) => new Promise((resolve, reject) => {
+                    const id = globalThis.nui_rpc.request(resolve, timeout, () => {
+                        reject(Object.assign(new Error("Rpc request timed out."), {name: "RpcTimeoutError"}));
+                    });
+                    if (signal !== undefined && signal !== null) {
+                        signal.addEventListener("abort", () => {
+                            if (globalThis.nui_rpc.cancel(id))
+                                reject(signal.reason);
+                        });
+                    }
+                    invoke("reply_" + id);
+                });
+
+                // Streams of all frontend clients share this table, so ids are unique and chunks reach their reader.
+                const streams = new Map();
+                let lastStreamId = 0;
+                globalThis.nui_rpc.openStream = (onChunk, onEnd) => {
+                    const id = ++lastStreamId;
+                    streams.set(id, {onChunk: onChunk, onEnd: onEnd});
+                    return id;
+                };
+                globalThis.nui_rpc.closeStream = (id) => streams.delete(id);
+                globalThis.nui_rpc.isStreamOpen = (id) => streams.has(id);
+                globalThis.nui_rpc.frontend["Nui::streamChunk"] = ([id, chunk]) => {
+                    const entry = streams.get(id);
+                    if (entry !== undefined)
+                        entry.onChunk(chunk);
+                };
+                globalThis.nui_rpc.frontend["Nui::streamEnd"] = ([id, error]) => {
+                    const entry = streams.get(id);
+                    if (entry === undefined)
+                        return;
+                    streams.delete(id);
+                    entry.onEnd(error);
+                };
+            })();
         )";
 
+        /// Single shot callbacks registered by the frontend start with this, they are dispatched by name.
+        constexpr static char const* temporaryFunctionPrefix = "temp_";
+
+        /// Back channels of calls registered in the pending call table of the frontend, followed by the call id.
+        constexpr static char const* replyPrefix = "reply_";
+
         struct AutoUnregister : public OnDestroy
         {
             AutoUnregister(RpcHub const* hub, std::string name)
@@ -159,17 +258,100 @@ namespace Nui
         };
 
         template <typename T>
-        AutoUnregister autoRegisterFunction(std::string const& name, T&& func) const
+        AutoUnregister autoRegisterFunction(std::string const& name, T&& func, BindOptions const& options = {}) const
         {
-            registerFunction(name, std::forward<T>(func));
+            registerFunction(name, std::forward<T>(func), options);
             return AutoUnregister{this, name};
         }
 
+        /**
+         * @brief Registers a function that is callable from the frontend.
+         *
+         * @param name The name of the function.
+         * @param func The function, its parameters are extracted from the json arguments.
+         * @param options Set async to run the function on the thread pool of the window. Replies via callRemote are
+         * evaluated on the main thread.
+         */
         template <typename T>
-        void registerFunction(std::string const& name, T&& func) const
+        void registerFunction(std::string const& name, T&& func, BindOptions const& options = {}) const
         {
             // window is threadsafe
-            window_->bind(name, Detail::FunctionWrapper<T>::wrapFunction(std::forward<T>(func)));
+            window_->bind(name, Detail::FunctionWrapper<T>::wrapFunction(std::forward<T>(func)), options);
+        }
+        /**
+         * @brief Registers the implementation of a typed rpc function declared with NUI_RPC. Arguments are read
+         * positionally from the call, a result is written directly as JSON text and sent back to the frontend.
+         *
+         * @param func The function, has to be callable with the arguments of the schema.
+         * @param options Set async to run the function on the thread pool of the window.
+         */
+        template <RpcSchemaType SchemaT, typename FunctionT>
+        void registerFunction(FunctionT&& func, BindOptions const& options = {}) const
+        {
+            static_assert(
+                isRpcSchemaImplementation<SchemaT, std::decay_t<FunctionT>>,
+                "The function does not match the signature of the rpc schema.");
+            window_->bind(
+                SchemaT::name,
+                [this, func = std::forward<FunctionT>(func)](nlohmann::json const& args) mutable {
+                    callSchemaFunction<SchemaT>(func, args, std::make_index_sequence<SchemaT::arity>{});
+                },
+                options);
+        }
+
+        /**
+         * @brief Registers a function that the frontend opens a stream with, see RpcStreamReader::open. The function
+         * receives a std::shared_ptr<RpcStream> followed by the arguments of the frontend and runs on the thread pool
+         * of the window. When the stream runs out of credit, the producer continues with RpcStream::whenWritable
+         * instead of waiting.
+         *
+         * @code{.cpp}
+         * void sendLines(std::shared_ptr<Nui::RpcStream> stream, std::shared_ptr<std::ifstream> file)
+         * {
+         *     std::string line;
+         *     while (stream->canWrite())
+         *     {
+         *         if (!std::getline(*file, line))
+         *             return stream->close();
+         *         stream->write(line);
+         *     }
+         *     stream->whenWritable([stream, file]() {
+         *         sendLines(stream, file);
+         *     });
+         * }
+         *
+         * hub.registerStream("readLines", [](std::shared_ptr<Nui::RpcStream> stream, std::string const& path) {
+         *     sendLines(stream, std::make_shared<std::ifstream>(path));
+         * });
+         * @endcode
+         *
+         * Exceptions of the function end the stream with the error and are reported to WindowOptions::onRpcError.
+         *
+         * @param name The name of the function.
+         * @param func The function, its parameters after the stream are extracted from the json arguments.
+         */
+        template <typename T>
+        void registerStream(std::string const& name, T&& func) const
+        {
+            using ArgsTuple = typename Traits::FunctionTraits<std::decay_t<T>>::ArgsTuple;
+            // The stream is opened on the main thread, so that credit and cancellation that follow are never lost.
+            window_->bind(name, [this, name, func = std::forward<T>(func)](nlohmann::json const& args) {
+                auto stream = openStream(args[0].get<std::uint32_t>(), args[1].get<std::uint32_t>());
+                boost::asio::post(
+                    window_->getExecutor(), [this, name, func, stream = std::move(stream), args]() mutable {
+                        try
+                        {
+                            callStreamFunction<ArgsTuple>(
+                                func, stream, args, std::make_index_sequence<std::tuple_size_v<ArgsTuple> - 1>{});
+                        }
+                        catch (std::exception const& exc)
+                        {
+                            // Would otherwise terminate, the pool has nothing to report it to.
+                            stream->fail(exc.what());
+                            window_->reportRpcError("Exception in rpc stream " + name + "\nException: " + exc.what());
+                        }
+                    });
+            });
         }
         void unregisterFunction(std::string const& name) const
         {
@@ -262,6 +444,69 @@ namespace Nui
             callRemote(name, std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Calls a typed frontend function declared with NUI_RPC. The arguments are converted to the types of
+         * the schema and written directly as JSON text.
+         */
+        template <RpcSchemaType SchemaT, typename... Args>
+        requires RpcSchemaArguments<SchemaT, Args...>
+        void call(Args&&... args) const
+        {
+            static_assert(
+                std::is_void_v<typename SchemaT::ReturnType>,
+                "Calls to the frontend cannot return a value, use request instead.");
+            std::string payload{"["};
+            writeSchemaArguments<typename SchemaT::ArgsTuple>(
+                payload, std::index_sequence_for<Args...>{}, std::forward<Args>(args)...);
+            payload.push_back(']');
+            dispatch(SchemaT::name, payload);
+        }
+
+        /**
+         * @brief Calls a frontend function that replies. The function receives a request id as its first argument and
+         * answers with RpcClient::replyToBackend(id, result).
+         *
+         * The reply is received on the main thread, so never wait for the future there. Wait in async handlers or
+         * other threads instead. The future holds an RpcRequestError if the request timed out (see
+         * setRequestTimeout) or the page was reloaded before the reply (see markRpcAsInitialized).
+         *
+         * @return std::future<nlohmann::json> The reply of the frontend.
+         */
+        template <typename... Args>
+        std::future<nlohmann::json> request(std::string const& name, Args&&... args) const
+        {
+            auto [id, reply] = registerRequest();
+            callRemote(name, id, std::forward<Args>(args)...);
+            return std::move(reply);
+        }
+
+        /**
+         * @brief Queues calls to the frontend and sends them as a single script, on the next iteration of the main
+         * loop or after the given delay. The order of calls is preserved, each call still runs on its own.
+         *
+         * @param delay Time to collect calls for, 0 sends them with the next main loop iteration.
+         */
+        void enableBatching(std::chrono::milliseconds delay = std::chrono::milliseconds{0});
+
+        /**
+         * @brief Sends calls to the frontend directly again. Already queued calls are still sent first, calls made
+         * before they are sent are queued behind them.
+         */
+        void disableBatching();
+
+        /**
+         * @brief Sets the time after which requests without a reply fail with an RpcRequestError. Applies to requests
+         * made afterwards, 0 waits indefinitely.
+         */
+        void setRequestTimeout(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Sets how long a continuation of RpcStream::whenWritable waits for credit before the stream fails, so
+         * that a frontend that stopped reading does not keep the producer forever. Applies to streams opened
+         * afterwards, 0 waits indefinitely. Defaults to 30 seconds.
+         */
+        void setStreamCreditTimeout(std::chrono::milliseconds timeout);
+
         /**
          * @brief Enables file dialog functionality
          */
@@ -327,23 +572,108 @@ namespace Nui
             return iter->second.get();
         }
 
+        /**
+         * @brief Sets the initialized flag of the frontend, usually in WindowOptions::onRpcAliveMessage. Since this
+         * happens once per page load, requests that are still waiting for a reply from a previous page fail with an
+         * RpcRequestError and open streams are cancelled.
+         */
         void markRpcAsInitialized();
 
       private:
-        void callRemoteImpl(std::string const& name, nlohmann::json const& json) const
+        void callRemoteImpl(std::string const& name, nlohmann::json const& json) const;
+        void callRemoteImpl(std::string const& name) const;
+        template <typename ArgsTuple, typename FunctionT, std::size_t... Is>
+        static void callStreamFunction(
+            FunctionT& func,
+            std::shared_ptr<RpcStream> stream,
+            nlohmann::json const& args,
+            std::index_sequence<Is...>)
         {
-            // window is threadsafe.
-            window_->eval(fmt::format(remoteCallScript, name, json.dump()));
+            func(std::move(stream), Detail::extractJsonMember<std::tuple_element_t<Is + 1, ArgsTuple>>(args[Is + 2])...);
         }
-        void callRemoteImpl(std::string const& name) const
+
+        template <typename SchemaT, typename FunctionT, std::size_t... Is>
+        void callSchemaFunction(FunctionT& func, nlohmann::json const& args, std::index_sequence<Is...>) const
         {
-            // window is threadsafe.
-            window_->eval(fmt::format(remoteCallScript, name, "undefined"));
+            using ArgsTuple = typename SchemaT::ArgsTuple;
+            using ReturnType = typename SchemaT::ReturnType;
+            if constexpr (std::is_void_v<ReturnType>)
+            {
+                func(Detail::readRpcPayload<std::tuple_element_t<Is, ArgsTuple>>(args.at(Is))...);
+            }
+            else
+            {
+                // The frontend passes the back channel for the result first.
+                const ReturnType result =
+                    func(Detail::readRpcPayload<std::tuple_element_t<Is, ArgsTuple>>(args.at(Is + 1))...);
+                std::string payload;
+                Detail::writeRpcPayload(payload, result);
+                dispatch(args.at(0).get<std::string>(), payload);
+            }
+        }
+
+        template <typename ArgsTuple, std::size_t... Is, typename... Args>
+        static void writeSchemaArguments(std::string& payload, std::index_sequence<Is...>, Args&&... args)
+        {
+            bool first = true;
+            (
+                [&]() {
+                    if (!std::exchange(first, false))
+                        payload.push_back(',');
+                    Detail::writeRpcPayload<std::tuple_element_t<Is, ArgsTuple>>(payload, args);
+                }(),
+                ...);
         }
 
+        friend class RpcStream;
+        std::shared_ptr<RpcStream> openStream(std::uint32_t id, std::uint32_t credit) const;
+        void closeStream(std::uint32_t id) const;
+        void cancelAllStreams() const;
+
+        void dispatch(std::string const& name, std::string const& payload) const;
+        /**
+         * @brief Evaluates the script in the view, either directly or with the current batch.
+         *
+         * @param onEvaluated Runs on the main thread once the script was handed to the view.
+         */
+        void send(std::string const& script, std::function<void()> onEvaluated = {}) const;
+        std::pair<std::uint32_t, std::future<nlohmann::json>> registerRequest() const;
+        void resolveRequest(std::uint32_t id, nlohmann::json const& reply) const;
+        void failAllRequests(std::string const& reason) const;
+
       private:
         std::recursive_mutex guard_;
         Window* window_;
         std::unordered_map<std::string, std::unique_ptr<void, std::function<void(void*)>>> stateStores_;
+
+        struct FunctionId
+        {
+            std::size_t id;
+            // Set on the main thread once a dispatch that defines the id was evaluated. Shared, so that the
+            // notification does not depend on the hub still existing.
+            std::shared_ptr<std::atomic_bool> defined;
+        };
+        mutable std::mutex dispatchGuard_;
+        mutable std::unordered_map<std::string, FunctionId> functionIds_;
+        std::shared_ptr<Detail::RpcCallBatch> batch_;
+        struct PendingRequest
+        {
+            std::promise<nlohmann::json> promise;
+            std::shared_ptr<boost::asio::steady_timer> timeout;
+        };
+        struct PendingRequests
+        {
+            std::mutex guard{};
+            std::uint32_t lastId{0};
+            std::chrono::milliseconds timeout{0};
+            std::unordered_map<std::uint32_t, PendingRequest> requests{};
+
+            void fail(std::uint32_t id, std::string const& reason);
+        };
+        // Shared with the timeout handlers, which may still run after the hub is gone.
+        std::shared_ptr<PendingRequests> pendingRequests_;
+        mutable std::mutex streamGuard_;
+        std::chrono::milliseconds streamCreditTimeout_;
+        mutable std::unordered_map<std::uint32_t, std::weak_ptr<RpcStream>> streams_;
     };
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <nui/backend/rpc_encoding.hpp>
+
+#include <nlohmann/json.hpp>
+#include <fmt/format.h>
+
+#include <boost/describe.hpp>
+#include <boost/mp11/algorithm.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nui::Detail
+{
+    // Defined in rpc_hub.hpp
+    template <typename ArgT>
+    constexpr static auto extractJsonMember(nlohmann::json const& json) -> decltype(auto);
+
+    template <typename T>
+    struct IsRpcOptional : std::false_type
+    {};
+    template <typename T>
+    struct IsRpcOptional<std::optional<T>> : std::true_type
+    {};
+
+    template <typename T>
+    struct IsRpcVector : std::false_type
+    {};
+    template <typename T, typename AllocatorT>
+    struct IsRpcVector<std::vector<T, AllocatorT>> : std::true_type
+    {};
+
+    template <typename T>
+    using RpcDescribedMembers =
+        boost::describe::describe_members<T, boost::describe::mod_any_access | boost::describe::mod_inherited>;
+
+    /**
+     * @brief Writes the value of a typed rpc call directly as JSON text, without building a json object first.
+     * Described structs are written as arrays of their members. Types that are not known are written with their
+     * nlohmann serializer.
+     */
+    template <typename T>
+    void writeRpcPayload(std::string& out, T const& value)
+    {
+        using Decayed = std::decay_t<T>;
+        if constexpr (std::is_same_v<Decayed, bool>)
+        {
+            out += value ? "true" : "false";
+        }
+        else if constexpr (std::is_same_v<Decayed, std::uint64_t> || std::is_same_v<Decayed, std::int64_t>)
+        {
+            // Same split form as the untyped calls, JSON numbers lose precision above 53 bits.
+            constexpr unsigned u32BitCount = 32;
+            constexpr std::uint64_t u32Mask = 0xFFFFFFFFu;
+            const auto uv = static_cast<std::uint64_t>(value);
+            fmt::format_to(
+                std::back_inserter(out),
+                R"({{"_u64_hi":{},"_u64_lo":{}}})",
+                static_cast<std::uint32_t>((uv >> u32BitCount) & u32Mask),
+                static_cast<std::uint32_t>(uv & u32Mask));
+        }
+        else if constexpr (std::is_integral_v<Decayed>)
+        {
+            fmt::format_to(std::back_inserter(out), "{}", value);
+        }
+        else if constexpr (std::is_floating_point_v<Decayed>)
+        {
+            if (std::isfinite(value))
+                fmt::format_to(std::back_inserter(out), "{}", value);
+            else
+                out += "null";
+        }
+        else if constexpr (std::is_enum_v<Decayed>)
+        {
+            writeRpcPayload(out, static_cast<std::underlying_type_t<Decayed>>(value));
+        }
+        else if constexpr (std::is_convertible_v<Decayed const&, std::string_view>)
+        {
+            appendJsonString(out, std::string_view{value});
+        }
+        else if constexpr (IsRpcOptional<Decayed>::value)
+        {
+            if (value)
+                writeRpcPayload(out, *value);
+            else
+                out += "null";
+        }
+        else if constexpr (IsRpcVector<Decayed>::value)
+        {
+            out.push_back('[');
+            bool first = true;
+            for (auto const& element : value)
+            {
+                if (!std::exchange(first, false))
+                    out.push_back(',');
+                writeRpcPayload(out, static_cast<typename Decayed::value_type const&>(element));
+            }
+            out.push_back(']');
+        }
+        else if constexpr (boost::describe::has_describe_members<Decayed>::value)
+        {
+            out.push_back('[');
+            bool first = true;
+            boost::mp11::mp_for_each<RpcDescribedMembers<Decayed>>([&](auto member) {
+                if (!std::exchange(first, false))
+                    out.push_back(',');
+                writeRpcPayload(out, value.*member.pointer);
+            });
+            out.push_back(']');
+        }
+        else
+        {
+            out += nlohmann::json(value).dump();
+        }
+    }
+
+    /**
+     * @brief Reads an argument of a typed rpc call. Described structs are read from arrays of their members.
+     */
+    template <typename T>
+    T readRpcPayload(nlohmann::json const& json)
+    {
+        using Decayed = std::decay_t<T>;
+        if constexpr (IsRpcOptional<Decayed>::value)
+        {
+            if (json.is_null())
+                return std::nullopt;
+            return readRpcPayload<typename Decayed::value_type>(json);
+        }
+        else if constexpr (
+            IsRpcVector<Decayed>::value && !std::is_same_v<Decayed, std::vector<std::uint8_t>> &&
+            !std::is_same_v<Decayed, std::vector<bool>>)
+        {
+            Decayed result;
+            result.reserve(json.size());
+            for (auto const& element : json)
+                result.push_back(readRpcPayload<typename Decayed::value_type>(element));
+            return result;
+        }
+        else if constexpr (boost::describe::has_describe_members<Decayed>::value && !std::is_enum_v<Decayed>)
+        {
+            Decayed result{};
+            std::size_t index = 0;
+            boost::mp11::mp_for_each<RpcDescribedMembers<Decayed>>([&](auto member) {
+                using MemberType = std::remove_cvref_t<decltype(result.*member.pointer)>;
+                result.*member.pointer = readRpcPayload<MemberType>(json.at(index++));
+            });
+            return result;
+        }
+        else
+        {
+            return extractJsonMember<Decayed>(json);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Nui
+{
+    class RpcHub;
+
+    /**
+     * @brief The producing end of a stream that was opened by the frontend with RpcStreamReader::open. The frontend
+     * grants credit for a number of chunks and grants more as it processes them. This keeps the amount of chunks in
+     * flight bounded.
+     *
+     * Writing never blocks. When no credit is left, the producer parks a continuation with whenWritable, which runs on
+     * the thread pool of the window once credit arrives, so no thread of the pool waits for the frontend. The stream
+     * must not outlive the RpcHub.
+     */
+    class RpcStream : public std::enable_shared_from_this<RpcStream>
+    {
+      public:
+        RpcStream(RpcHub const& hub, std::uint32_t id, std::uint32_t credit, std::chrono::milliseconds creditTimeout);
+        ~RpcStream();
+        RpcStream(RpcStream const&) = delete;
+        RpcStream(RpcStream&&) = delete;
+        RpcStream& operator=(RpcStream const&) = delete;
+        RpcStream& operator=(RpcStream&&) = delete;
+
+        /**
+         * @brief Sends a chunk to the frontend if there is credit for it.
+         *
+         * @return true if the chunk was sent, false if no credit is left or the stream ended.
+         */
+        bool write(nlohmann::json const& chunk);
+
+        /**
+         * @brief Returns true if the stream is open and has credit, so that the next write sends its chunk.
+         */
+        bool canWrite() const;
+
+        /**
+         * @brief Runs the continuation on the thread pool of the window as soon as the stream has credit. Only one
+         * continuation waits at a time, a later one replaces it. The continuation is dropped if the stream ends
+         * first, including when no credit arrives within the credit timeout (see RpcHub::setStreamCreditTimeout).
+         * An exception of the continuation fails the stream and is reported to WindowOptions::onRpcError.
+         */
+        void whenWritable(std::function<void()> continuation);
+
+        /**
+         * @brief Ends the stream successfully. Also happens when the stream is destroyed.
+         */
+        void close();
+
+        /**
+         * @brief Ends the stream with an error that is passed to the frontend.
+         */
+        void fail(std::string const& error);
+
+        /**
+         * @brief Returns true if the frontend cancelled the stream. Producers should stop as soon as possible.
+         */
+        bool isCancelled() const;
+
+        std::uint32_t id() const;
+
+      private:
+        friend class RpcHub;
+
+        void grant(std::uint32_t credit);
+        void cancel();
+        void finish(nlohmann::json const& error);
+        void resume();
+        void dropContinuation();
+        void creditTimedOut(boost::asio::steady_timer const* timer);
+        void post(std::function<void()> continuation);
+
+      private:
+        enum class State
+        {
+            Open,
+            Closed,
+            Cancelled
+        };
+
+        RpcHub const* hub_;
+        std::uint32_t id_;
+        mutable std::mutex guard_;
+        std::uint32_t credit_;
+        std::chrono::milliseconds creditTimeout_;
+        State state_;
+        std::function<void()> continuation_;
+        std::shared_ptr<boost::asio::steady_timer> creditTimer_;
+    };
+}
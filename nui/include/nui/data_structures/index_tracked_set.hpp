@@ -0,0 +1,175 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+namespace Nui
+{
+    /**
+     * This container stores unique values in a contiguous vector and allows for O(1) removal by value. Removal
+     * swaps the last element into the freed position, so the order of elements is not preserved.
+     *
+     * Small sets are searched linearly, the value to index map is only built once the set grows beyond
+     * indexThreshold elements.
+     *
+     * @tparam T Type of the values, must be hashable and equality comparable.
+     */
+    template <typename T>
+    class IndexTrackedSet
+    {
+      public:
+        /// @brief Up to this many elements, lookups are linear and no index is maintained.
+        constexpr static std::size_t indexThreshold = 16;
+
+        using value_type = T;
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+      public:
+        IndexTrackedSet() = default;
+        IndexTrackedSet(IndexTrackedSet const&) = default;
+        IndexTrackedSet(IndexTrackedSet&&) = default;
+        IndexTrackedSet& operator=(IndexTrackedSet const&) = default;
+        IndexTrackedSet& operator=(IndexTrackedSet&&) = default;
+        ~IndexTrackedSet() = default;
+
+        /**
+         * @brief Inserts the value if it is not already contained.
+         *
+         * @return true if the value was inserted.
+         */
+        bool insert(T const& value)
+        {
+            if (find(value) != npos)
+                return false;
+            values_.push_back(value);
+            if (!indices_.empty())
+                indices_.emplace(value, values_.size() - 1);
+            else if (values_.size() > indexThreshold)
+                buildIndex();
+            return true;
+        }
+
+        /**
+         * @brief Removes the value if it is contained.
+         *
+         * @return true if the value was removed.
+         */
+        bool erase(T const& value)
+        {
+            auto const index = find(value);
+            if (index == npos)
+                return false;
+            eraseAt(index);
+            return true;
+        }
+
+        /**
+         * @brief Removes all values for which the predicate returns true. Linear in the size of the set.
+         *
+         * @return The number of removed values.
+         */
+        template <typename PredicateT>
+        std::size_t eraseIf(PredicateT&& predicate)
+        {
+            std::size_t removed = 0;
+            for (std::size_t i = 0; i < values_.size();)
+            {
+                if (predicate(values_[i]))
+                {
+                    eraseAt(i);
+                    ++removed;
+                }
+                else
+                    ++i;
+            }
+            return removed;
+        }
+
+        bool contains(T const& value) const
+        {
+            return find(value) != npos;
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            values_.reserve(capacity);
+        }
+
+        void clear()
+        {
+            values_.clear();
+            indices_.clear();
+        }
+
+        std::size_t size() const
+        {
+            return values_.size();
+        }
+
+        bool empty() const
+        {
+            return values_.empty();
+        }
+
+        iterator begin()
+        {
+            return values_.begin();
+        }
+        iterator end()
+        {
+            return values_.end();
+        }
+        const_iterator begin() const
+        {
+            return values_.begin();
+        }
+        const_iterator end() const
+        {
+            return values_.end();
+        }
+
+      private:
+        constexpr static std::size_t npos = static_cast<std::size_t>(-1);
+
+        std::size_t find(T const& value) const
+        {
+            if (!indices_.empty())
+            {
+                auto iter = indices_.find(value);
+                return iter == indices_.end() ? npos : iter->second;
+            }
+            auto iter = std::find(values_.begin(), values_.end(), value);
+            return iter == values_.end() ? npos : static_cast<std::size_t>(std::distance(values_.begin(), iter));
+        }
+
+        void eraseAt(std::size_t index)
+        {
+            if (!indices_.empty())
+                indices_.erase(values_[index]);
+            if (index != values_.size() - 1)
+            {
+                values_[index] = std::move(values_.back());
+                if (!indices_.empty())
+                    indices_[values_[index]] = index;
+            }
+            values_.pop_back();
+            if (values_.size() <= indexThreshold / 2)
+                indices_.clear();
+        }
+
+        void buildIndex()
+        {
+            indices_.reserve(values_.size());
+            for (std::size_t i = 0; i != values_.size(); ++i)
+                indices_.emplace(values_[i], i);
+        }
+
+      private:
+        std::vector<T> values_{};
+        std::unordered_map<T, std::size_t> indices_{};
+    };
+}
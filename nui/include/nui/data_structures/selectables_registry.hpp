@@ -9,6 +9,7 @@
 #include <limits>
 #include <set>
 #include <iterator>
+#include <concepts>
 
 namespace Nui
 {
@@ -442,6 +443,41 @@ namespace Nui
             return false;
         }
 
+        /**
+         * @brief Erases unselected items for which the predicate returns true, stepping over at most maxVisited
+         * slots starting at the item with id fromId (or the next larger id). Empty and selected slots count towards
+         * the limit. The container is condensed at most once.
+         *
+         * @param fromId Id to continue from.
+         * @param maxVisited Maximum amount of slots to step over.
+         * @param predicate Returns true for items that shall be erased.
+         * @return IdType The id to continue from in the next call, or invalidId if the end was reached.
+         */
+        IdType eraseIf(IdType fromId, std::size_t maxVisited, std::predicate<T const&> auto const& predicate)
+        {
+            auto iter = std::lower_bound(std::begin(items_), std::end(items_), fromId, [](auto const& lhs, auto rhs) {
+                return lhs.id < rhs;
+            });
+
+            bool erasedAny = false;
+            for (std::size_t visited = 0; iter != std::end(items_) && visited < maxVisited; ++iter, ++visited)
+            {
+                if (!iter->item)
+                    continue;
+                if (predicate(*iter->item))
+                {
+                    iter->item.reset();
+                    --itemCount_;
+                    erasedAny = true;
+                }
+            }
+
+            const auto nextId = iter == std::end(items_) ? invalidId : iter->id;
+            if (erasedAny)
+                condense();
+            return nextId;
+        }
+
         void clear()
         {
             items_.clear();
@@ -72,7 +72,10 @@ namespace Nui
          */
         void executeActiveEventsImmediately()
         {
-            impl_->eventRegistry().executeActiveEvents();
+            auto& registry = impl_->eventRegistry();
+            if (registry.isInTransaction())
+                return registry.requestFlush();
+            registry.executeActiveEvents();
         }
 
         /**
@@ -80,7 +83,24 @@ namespace Nui
          */
         void sync()
         {
-            impl_->eventRegistry().executeActiveEvents();
+            executeActiveEventsImmediately();
+        }
+
+        /**
+         * @brief Counts completed event executions. Can be used to tell apart changes that happened before and after
+         * an execution.
+         */
+        std::size_t executionCount() const
+        {
+            return impl_->eventRegistry().executionCount();
+        }
+
+        /**
+         * @brief Arena for the temporaries of Dom::Element::setup. Allocate from it only within a FrameArena::Scope.
+         */
+        FrameArena& frameArena()
+        {
+            return impl_->eventRegistry().frameArena();
         }
 
         /**
@@ -102,6 +122,25 @@ namespace Nui
         {
             impl_->eventRegistry().cleanInvalidEvents();
         }
+
+        /**
+         * @brief Incremental variant of cleanInvalidEvents that checks at most maxVisited events and continues where
+         * the last call stopped.
+         *
+         * @return true if a full pass over the registry was completed with this call.
+         */
+        bool cleanInvalidEvents(std::size_t maxVisited)
+        {
+            return impl_->eventRegistry().cleanInvalidEvents(maxVisited);
+        }
+
+        /**
+         * @brief Makes every event execution also clean up at most maxVisited invalid events. 0 disables this.
+         */
+        void setCleanupBudgetPerExecution(std::size_t maxVisited)
+        {
+            impl_->eventRegistry().setCleanupBudgetPerExecution(maxVisited);
+        }
         void removeAfterEffect(EventIdType id)
         {
             impl_->eventRegistry().removeAfterEffect(id);
@@ -135,6 +174,41 @@ namespace Nui
             impl_->eventRegistry().delayToAfterProcessing(std::move(func));
         }
 
+        /**
+         * @brief Starts a transaction. Until the matching endTransaction, modified observeds do not activate their
+         * events. Transactions can be nested, only leaving the outermost one commits.
+         * Prefer the Transaction guard or transaction() over calling this directly.
+         */
+        void beginTransaction()
+        {
+            impl_->eventRegistry().beginTransaction();
+        }
+
+        /**
+         * @brief Ends a transaction. When the outermost transaction ends, every observed that was modified within
+         * activates its events once. If events were supposed to be executed during the transaction, this is done
+         * now.
+         */
+        void endTransaction();
+
+        bool isInTransaction() const
+        {
+            return impl_->eventRegistry().isInTransaction();
+        }
+
+        std::size_t deferUpdate(ObservedBase const* observed)
+        {
+            return impl_->eventRegistry().deferUpdate(observed);
+        }
+        bool isDeferred(std::size_t slot, ObservedBase const* observed) const
+        {
+            return impl_->eventRegistry().isDeferred(slot, observed);
+        }
+        void cancelDeferredUpdate(std::size_t slot, ObservedBase const* observed)
+        {
+            impl_->eventRegistry().cancelDeferredUpdate(slot, observed);
+        }
+
       private:
         std::shared_ptr<EventEngine> impl_;
     };
@@ -2,12 +2,19 @@
 
 #include <nui/data_structures/selectables_registry.hpp>
 #include <nui/event_system/event.hpp>
+#include <nui/event_system/frame_arena.hpp>
 #include <nui/utility/visit_overloaded.hpp>
 
 #include <limits>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <cstddef>
 
 namespace Nui
 {
+    class ObservedBase;
+
     class EventRegistry
     {
       public:
@@ -107,21 +114,56 @@ namespace Nui
             delayedAfterProcessing_.clear();
             for (auto& func : funcs)
                 func();
+            if (cleanupBudgetPerExecution_ != 0)
+                cleanInvalidEvents(cleanupBudgetPerExecution_);
+            ++executionCount_;
+        }
+
+        /**
+         * @brief Counts how often executeActiveEvents has completed.
+         */
+        std::size_t executionCount() const
+        {
+            return executionCount_;
         }
 
+        /**
+         * @brief Removes all events that are no longer valid in one sweep.
+         */
         void cleanInvalidEvents()
         {
-            std::vector<EventIdType> invalidIds;
-            for (auto const& itemWithId : registry_.rawRange())
+            registry_.eraseIf(0, std::numeric_limits<std::size_t>::max(), [](Event const& event) {
+                return !static_cast<bool>(event);
+            });
+            cleanupCursor_ = 0;
+        }
+
+        /**
+         * @brief Checks at most maxVisited events for validity and removes invalid ones. Continues where the previous
+         * call stopped and wraps around at the end, so events invalidated in the meantime are found in a later pass.
+         *
+         * @return true if the sweep reached the end of the registry.
+         */
+        bool cleanInvalidEvents(std::size_t maxVisited)
+        {
+            cleanupCursor_ = registry_.eraseIf(cleanupCursor_, maxVisited, [](Event const& event) {
+                return !static_cast<bool>(event);
+            });
+            if (cleanupCursor_ == RegistryType::invalidId)
             {
-                if (!itemWithId.item)
-                    continue;
-                if (!static_cast<bool>(itemWithId.item.value()))
-                    invalidIds.push_back(itemWithId.id);
+                cleanupCursor_ = 0;
+                return true;
             }
+            return false;
+        }
 
-            for (auto const& id : invalidIds)
-                registry_.erase(id);
+        /**
+         * @brief When set to a value other than 0, every executeActiveEvents checks this many events for validity
+         * and removes invalid ones. This spreads the cleanup over many flushes.
+         */
+        void setCleanupBudgetPerExecution(std::size_t maxVisited)
+        {
+            cleanupBudgetPerExecution_ = maxVisited;
         }
 
         void removeAfterEffect(EventIdType id)
@@ -133,6 +175,10 @@ namespace Nui
         {
             registry_.clear();
             afterEffects_.clear();
+            transactionDepth_ = 0;
+            deferredUpdates_.clear();
+            flushRequested_ = false;
+            cleanupCursor_ = 0;
         }
 
         bool isExecutingEvents() const
@@ -140,15 +186,94 @@ namespace Nui
             return executingEvents_;
         }
 
+        /**
+         * @brief The arena for temporaries of Dom::Element::setup, it is reset when the setup is done.
+         */
+        FrameArena& frameArena()
+        {
+            return *frameArena_;
+        }
+
         void delayToAfterProcessing(std::function<void()> func)
         {
             delayedAfterProcessing_.push_back(std::move(func));
         }
 
+        void beginTransaction()
+        {
+            ++transactionDepth_;
+        }
+
+        /**
+         * @brief Leaves one transaction level.
+         *
+         * @return true if the outermost transaction was left and the deferred updates must be committed.
+         */
+        bool endTransaction()
+        {
+            if (transactionDepth_ == 0)
+                return false;
+            return --transactionDepth_ == 0;
+        }
+
+        bool isInTransaction() const
+        {
+            return transactionDepth_ > 0;
+        }
+
+        /**
+         * @brief Records an observed whose update is postponed until the transaction is committed.
+         *
+         * @return The slot of the observed, which can be used to cancel the deferred update.
+         */
+        std::size_t deferUpdate(ObservedBase const* observed)
+        {
+            deferredUpdates_.push_back(observed);
+            return deferredUpdates_.size() - 1;
+        }
+
+        bool isDeferred(std::size_t slot, ObservedBase const* observed) const
+        {
+            return slot < deferredUpdates_.size() && deferredUpdates_[slot] == observed;
+        }
+
+        void cancelDeferredUpdate(std::size_t slot, ObservedBase const* observed)
+        {
+            if (isDeferred(slot, observed))
+                deferredUpdates_[slot] = nullptr;
+        }
+
+        std::vector<ObservedBase const*> takeDeferredUpdates()
+        {
+            auto deferred = std::move(deferredUpdates_);
+            deferredUpdates_.clear();
+            return deferred;
+        }
+
+        /**
+         * @brief Remembers that events were supposed to be executed while in a transaction.
+         */
+        void requestFlush()
+        {
+            flushRequested_ = true;
+        }
+
+        bool takeFlushRequest()
+        {
+            return std::exchange(flushRequested_, false);
+        }
+
       private:
         RegistryType registry_;
         RegistryType afterEffects_;
         bool executingEvents_{false};
         std::vector<std::function<void()>> delayedAfterProcessing_;
+        std::size_t transactionDepth_{0};
+        std::vector<ObservedBase const*> deferredUpdates_;
+        bool flushRequested_{false};
+        EventIdType cleanupCursor_{0};
+        std::size_t cleanupBudgetPerExecution_{0};
+        std::size_t executionCount_{0};
+        std::unique_ptr<FrameArena> frameArena_{std::make_unique<FrameArena>()};
     };
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Nui
+{
+    /**
+     * @brief A bump allocator for temporaries that only live while an element is set up. All memory is released at
+     * once when the outermost scope is left, the initial buffer is kept and reused, so that setting up the elements of
+     * a render usually does not touch the global allocator for them at all.
+     *
+     * Nothing allocated from the arena may be kept beyond the scope it was allocated in.
+     */
+    class FrameArena
+    {
+      public:
+        static constexpr std::size_t defaultCapacity = 16 * 1024;
+
+        class Scope
+        {
+          public:
+            explicit Scope(FrameArena& arena)
+                : arena_{&arena}
+            {
+                arena_->enter();
+            }
+            ~Scope()
+            {
+                arena_->leave();
+            }
+            Scope(Scope const&) = delete;
+            Scope(Scope&&) = delete;
+            Scope& operator=(Scope const&) = delete;
+            Scope& operator=(Scope&&) = delete;
+
+          private:
+            FrameArena* arena_;
+        };
+
+        explicit FrameArena(std::size_t capacity = defaultCapacity)
+            : buffer_{std::make_unique<std::byte[]>(capacity)}
+            , resource_{buffer_.get(), capacity, std::pmr::new_delete_resource()}
+        {}
+        ~FrameArena() = default;
+        FrameArena(FrameArena const&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(FrameArena const&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+
+        /**
+         * @brief The memory resource to use for std::pmr containers within a scope.
+         */
+        std::pmr::memory_resource* resource()
+        {
+            return &resource_;
+        }
+
+      private:
+        void enter()
+        {
+            ++depth_;
+        }
+        void leave()
+        {
+            if (--depth_ == 0)
+                resource_.release();
+        }
+
+      private:
+        std::unique_ptr<std::byte[]> buffer_;
+        std::pmr::monotonic_buffer_resource resource_;
+        std::size_t depth_{0};
+    };
+}
@@ -7,7 +7,6 @@
 #include <memory>
 #include <functional>
 #include <type_traits>
-#include <variant>
 
 namespace Nui
 {
@@ -27,13 +26,12 @@ namespace Nui
         {}
         ListenRemover(EventContext::EventIdType id, ObservedType const& obs)
             : id_{id}
-            , obs_{std::get<ObservedMemberType>(
-                  [&obs]() -> std::variant<ObservedType const*, std::shared_ptr<ObservedType>> {
-                      if constexpr (IsSharedObserved<ObservedType>)
-                          return obs;
-                      else
-                          return &obs;
-                  }())}
+            , obs_{[&obs]() -> ObservedMemberType {
+                if constexpr (IsSharedObserved<ObservedType>)
+                    return obs;
+                else
+                    return &obs;
+            }()}
         {}
         ~ListenRemover()
         {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <nui/concepts.hpp>
+#include <nui/data_structures/index_tracked_set.hpp>
 #include <nui/event_system/range_event_context.hpp>
 #include <nui/event_system/event_context.hpp>
+#include <nui/event_system/tags_traits/suppress_unchanged.hpp>
 #include <nui/utility/assert.hpp>
 #include <nui/utility/meta/pick_first.hpp>
 #include <nui/utility/move_detector.hpp>
@@ -22,6 +24,7 @@
 #include <exception>
 #include <unordered_map>
 #include <map>
+#include <limits>
 
 namespace Nui
 {
@@ -32,12 +35,18 @@ namespace Nui
     class ObservedBase
     {
       public:
+        friend class EventContext;
+
         explicit ObservedBase(CustomEventContextFlag_t, EventContext& ctx)
             : eventContext_{&ctx}
             , attachedEvents_{}
             , attachedOneshotEvents_{}
         {}
-        virtual ~ObservedBase() = default;
+        virtual ~ObservedBase()
+        {
+            if (transactionSlot_ != noTransactionSlot && eventContext_ != nullptr)
+                eventContext_->cancelDeferredUpdate(transactionSlot_, this);
+        }
         ObservedBase(ObservedBase const&) = delete;
         ObservedBase(ObservedBase&& other) noexcept
             : eventContext_{other.eventContext_}
@@ -51,12 +60,8 @@ namespace Nui
                 attachedEvents_.reserve(attachedEvents_.size() + other.attachedEvents_.size());
                 attachedOneshotEvents_.reserve(attachedOneshotEvents_.size() + other.attachedOneshotEvents_.size());
 
-                for (auto& event : other.attachedEvents_)
-                {
-                    // Dont want to lose the move if event becomes non trivial
-                    // NOLINTNEXTLINE(performance-move-const-arg, hicpp-move-const-arg)
-                    attachedEvents_.push_back(std::move(event));
-                }
+                for (auto const& event : other.attachedEvents_)
+                    attachedEvents_.insert(event);
                 for (auto& event : other.attachedOneshotEvents_)
                 {
                     // Dont want to lose the move if event becomes non trivial
@@ -78,12 +83,8 @@ namespace Nui
                 attachedEvents_.reserve(attachedEvents_.size() + other.attachedEvents_.size());
                 attachedOneshotEvents_.reserve(attachedOneshotEvents_.size() + other.attachedOneshotEvents_.size());
 
-                for (auto& event : other.attachedEvents_)
-                {
-                    // Dont want to lose the move if event becomes non trivial
-                    // NOLINTNEXTLINE(performance-move-const-arg, hicpp-move-const-arg)
-                    attachedEvents_.push_back(std::move(event));
-                }
+                for (auto const& event : other.attachedEvents_)
+                    attachedEvents_.insert(event);
                 for (auto& event : other.attachedOneshotEvents_)
                 {
                     // Dont want to lose the move if event becomes non trivial
@@ -101,17 +102,18 @@ namespace Nui
 
         void attachEvent(EventContext::EventIdType eventId) const
         {
-            attachedEvents_.emplace_back(eventId);
+            attachedEvents_.insert(eventId);
         }
         void attachOneshotEvent(EventContext::EventIdType eventId) const
         {
             attachedOneshotEvents_.emplace_back(eventId);
         }
+        /**
+         * @brief Detaches an event in constant time.
+         */
         void detachEvent(EventContext::EventIdType eventId) const
         {
-            attachedEvents_.erase(
-                std::remove(std::begin(attachedEvents_), std::end(attachedEvents_), eventId),
-                std::end(attachedEvents_));
+            attachedEvents_.erase(eventId);
         }
 
         std::size_t attachedEventCount() const
@@ -140,18 +142,15 @@ namespace Nui
         {
             NUI_ASSERT(eventContext_ != nullptr, "Event context must never be null.");
 
-            for (auto& event : attachedEvents_)
-            {
-                auto activationResult = eventContext_->activateEvent(event);
-                if (!activationResult.found)
-                    event = EventRegistry::invalidEventId;
-            }
+            if (deferUpdateToTransaction())
+                return;
+
+            attachedEvents_.eraseIf([this](EventContext::EventIdType event) {
+                return !eventContext_->activateEvent(event).found;
+            });
             for (auto& event : attachedOneshotEvents_)
                 eventContext_->activateEvent(event);
             attachedOneshotEvents_.clear();
-            attachedEvents_.erase(
-                std::remove(std::begin(attachedEvents_), std::end(attachedEvents_), EventRegistry::invalidEventId),
-                std::end(attachedEvents_));
         }
 
         void updateNow(bool force = false) const
@@ -169,9 +168,35 @@ namespace Nui
         }
 
       protected:
+        /**
+         * @brief When a transaction is running, the update is recorded (once) to be performed when the transaction
+         * is committed.
+         *
+         * @return true if the update was deferred and must not be performed now.
+         */
+        bool deferUpdateToTransaction() const
+        {
+            if (!eventContext_->isInTransaction())
+                return false;
+            if (transactionSlot_ == noTransactionSlot || !eventContext_->isDeferred(transactionSlot_, this))
+                transactionSlot_ = eventContext_->deferUpdate(this);
+            return true;
+        }
+
+      private:
+        void commitDeferredUpdate() const
+        {
+            transactionSlot_ = noTransactionSlot;
+            update();
+        }
+
+      protected:
+        static constexpr std::size_t noTransactionSlot = std::numeric_limits<std::size_t>::max();
+
         EventContext* eventContext_;
-        mutable std::vector<EventContext::EventIdType> attachedEvents_;
+        mutable IndexTrackedSet<EventContext::EventIdType> attachedEvents_;
         mutable std::vector<EventContext::EventIdType> attachedOneshotEvents_;
+        mutable std::size_t transactionSlot_{noTransactionSlot};
     };
 
     template <typename ContainedT, typename Tags = void>
@@ -271,18 +296,23 @@ namespace Nui
             {
                 ObservedBase::operator=(std::move(other));
                 contained_ = std::move(other.contained_);
+                recordChangedMembers(allMembersChanged);
                 update();
             }
             return *this;
         };
         ModifiableObserved& operator=(ContainedT const& contained)
         {
+            if (isUnchangedAssignment(contained))
+                return *this;
             contained_ = contained;
             update();
             return *this;
         }
         ModifiableObserved& operator=(ContainedT&& contained)
         {
+            if (isUnchangedAssignment(contained))
+                return *this;
             contained_ = std::move(contained);
             update();
             return *this;
@@ -317,6 +347,8 @@ namespace Nui
         template <typename T = ContainedT>
         ModifiableObserved& operator=(T&& t)
         {
+            if (isUnchangedAssignment(t))
+                return *this;
             contained_ = std::forward<T>(t);
             update();
             return *this;
@@ -326,6 +358,7 @@ namespace Nui
         requires PlusAssignable<T, U>
         ModifiableObserved<T, Tags>& operator+=(U const& rhs)
         {
+            recordChangedMembers(allMembersChanged);
             this->contained_ += rhs;
             return *this;
         }
@@ -333,6 +366,7 @@ namespace Nui
         requires MinusAssignable<T, U>
         ModifiableObserved<T, Tags>& operator-=(U const& rhs)
         {
+            recordChangedMembers(allMembersChanged);
             this->contained_ -= rhs;
             return *this;
         }
@@ -351,6 +385,7 @@ namespace Nui
         {
             if (contained_ != other)
             {
+                recordChangedMembers(allMembersChanged);
                 contained_ = std::forward<T>(other);
                 update();
             }
@@ -365,14 +400,50 @@ namespace Nui
          */
         ModificationProxy modify()
         {
+            recordChangedMembers(allMembersChanged);
             return ModificationProxy{*this};
         }
 
         ModificationProxy modifyNow()
         {
+            recordChangedMembers(allMembersChanged);
             return ModificationProxy{*this, true};
         }
 
+        void update(bool force = false) const override
+        {
+            // Changes made through value(), operator-> and the like are not diffed, so an update without recorded
+            // changes for the current execution must not report a stale mask.
+            if constexpr (Detail::HasMemberChangeTracking<Tags, ContainedT>)
+            {
+                if (memberChanges_.execution != eventContext_->executionCount())
+                    recordChangedMembers(allMembersChanged);
+            }
+            ObservedBase::update(force);
+        }
+
+        /**
+         * @brief Only available with member change tracking (see TrackMemberChanges). Returns a bit mask of the
+         * members that changed since the last event execution, or while the events are being executed, of the members
+         * that caused this execution.
+         */
+        unsigned long long changedMembers() const
+        requires Detail::HasMemberChangeTracking<Tags, ContainedT>
+        {
+            return memberChanges_.mask;
+        }
+
+        /**
+         * @brief Only available with member change tracking (see TrackMemberChanges). Checks whether the given member
+         * is part of changedMembers().
+         */
+        template <typename MemberPointerT>
+        requires Detail::HasMemberChangeTracking<Tags, ContainedT> && std::is_member_object_pointer_v<MemberPointerT>
+        bool memberChanged(MemberPointerT member) const
+        {
+            return (memberChanges_.mask & Tags::memberBit(member)) != 0;
+        }
+
         explicit operator bool() const
         requires std::convertible_to<ContainedT, bool>
         {
@@ -414,8 +485,69 @@ namespace Nui
             contained_ = std::forward<ContainedT>(t);
         }
 
+        /// @brief Value of changedMembers() when a change cannot be narrowed down to specific members.
+        static constexpr unsigned long long allMembersChanged = ~0ULL;
+
+      protected:
+        /**
+         * @brief Decides whether an assignment can be skipped because it would not change anything. This is only
+         * done for types that opted into it via tag or trait (see SuppressUnchanged).
+         */
+        template <typename T>
+        bool isUnchangedAssignment(T const& value)
+        {
+            if constexpr (
+                Detail::HasMemberChangeTracking<Tags, ContainedT> &&
+                std::same_as<std::remove_cvref_t<T>, ContainedT>)
+            {
+                auto const changed = static_cast<unsigned long long>(Tags::changedMembers(contained_, value));
+                if (changed == 0)
+                    return true;
+                recordChangedMembers(changed);
+                return false;
+            }
+            else
+            {
+                if constexpr (
+                    SuppressesUnchangedAssignment<ContainedT, Tags> && std::equality_comparable_with<ContainedT, T>)
+                {
+                    if (contained_ == value)
+                        return true;
+                }
+                recordChangedMembers(allMembersChanged);
+                return false;
+            }
+        }
+
+        void recordChangedMembers([[maybe_unused]] unsigned long long changed) const
+        {
+            if constexpr (Detail::HasMemberChangeTracking<Tags, ContainedT>)
+            {
+                auto const execution = eventContext_->executionCount();
+                if (memberChanges_.execution != execution)
+                {
+                    memberChanges_.mask = 0;
+                    memberChanges_.execution = execution;
+                }
+                memberChanges_.mask |= changed;
+            }
+        }
+
       protected:
         ContainedT contained_;
+
+      private:
+        struct MemberChanges
+        {
+            unsigned long long mask{allMembersChanged};
+            std::size_t execution{std::numeric_limits<std::size_t>::max()};
+        };
+        struct NoMemberChanges
+        {};
+        [[no_unique_address]] mutable std::conditional_t<
+            Detail::HasMemberChangeTracking<Tags, ContainedT>,
+            MemberChanges,
+            NoMemberChanges> memberChanges_{};
     };
 
     template <typename ContainerT, typename Tags = void>
@@ -485,7 +617,7 @@ namespace Nui
                 owner_->insertRangeChecked(pos_, pos_, RangeOperationType::Modify);
                 return *ref_;
             }
-            T const& getReadonly()
+            T const& getReadonly() const
             {
                 return *ref_;
             }
@@ -524,7 +656,7 @@ namespace Nui
         template <typename T, typename ContainerT, typename Tags = void>
         auto const& unwrapReferenceWrapper(ReferenceWrapper<T, ContainerT, Tags> const& wrapper)
         {
-            return wrapper.get();
+            return wrapper.getReadonly();
         }
         auto& unwrapReferenceWrapper(auto& ref)
         {
@@ -572,7 +704,7 @@ namespace Nui
                 owner_->insertRangeChecked(pos_, pos_, RangeOperationType::Modify);
                 return *ptr_;
             }
-            T const& getReadonly()
+            T const& getReadonly() const
             {
                 return *ptr_;
             }
@@ -778,6 +910,12 @@ namespace Nui
         template <typename T = ContainerT>
         ObservedContainer& operator=(T&& t)
         {
+            if constexpr (
+                SuppressesUnchangedAssignment<ContainerT, Tags> && std::equality_comparable_with<ContainerT, T>)
+            {
+                if (contained_ == t)
+                    return *this;
+            }
             contained_ = std::forward<T>(t);
             forEachReaderContext([](RangeEventContext& c) { c.reset(true); });
             update();
@@ -1170,6 +1308,21 @@ namespace Nui
         {
             return contained_;
         }
+
+        /**
+         * @brief Read only view of the container. Iterating or indexing through it never marks elements as modified,
+         * unlike the non-const iterators, operator[] and at(), which have to assume a write through the returned
+         * wrappers.
+         *
+         * @code{.cpp}
+         * for (auto const& row : rows.read())
+         *     total += row.price;
+         * @endcode
+         */
+        ContainerT const& read() const
+        {
+            return contained_;
+        }
         void attachReaderContext(std::shared_ptr<RangeEventContext> const& ctx) const
         {
             readerContexts_->emplace_back(ctx);
@@ -1185,6 +1338,8 @@ namespace Nui
         {
             if (force)
                 forEachReaderContext([](RangeEventContext& c) { c.reset(true); });
+            if (ObservedBase::deferUpdateToTransaction())
+                return;
             ObservedBase::eventContext_->activateAfterEffect(afterEffectId_);
             ObservedBase::update(force);
         }
@@ -1211,6 +1366,19 @@ namespace Nui
 
         void insertRangeChecked(std::size_t low, std::size_t high, RangeOperationType type)
         {
+            NUI_ASSERT(ObservedBase::eventContext_ != nullptr, "Event context must never be null.");
+            if (ObservedBase::eventContext_->isInTransaction())
+            {
+                // Flushing is not possible within a transaction. Ranges that cannot be merged fall back to a full
+                // range update at commit time.
+                forEachReaderContext([&](RangeEventContext& c) {
+                    if (c.insertModificationRange(low, high, type) != RangeEventContext::InsertResult::Accepted)
+                        c.reset(true);
+                });
+                update();
+                return;
+            }
+
             std::function<void(int)> doInsert;
             doInsert = [&](int retries) {
                 NUI_ASSERT(ObservedBase::eventContext_ != nullptr, "Event context must never be null.");
@@ -1285,6 +1453,15 @@ namespace Nui
 
         void eraseNotify(std::size_t index, std::size_t high)
         {
+            if (ObservedBase::eventContext_->isInTransaction())
+            {
+                forEachReaderContext([&](RangeEventContext& c) {
+                    if (c.eraseNotify(index, high))
+                        c.reset(true);
+                });
+                return;
+            }
+
             bool anyFixup = false;
             forEachReaderContext([&](RangeEventContext& c) {
                 if (c.eraseNotify(index, high))
@@ -6,9 +6,11 @@
 #include <nui/event_system/observed_value.hpp>
 #include <nui/event_system/observed_value_combinator.hpp>
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 #include <functional>
+#include <optional>
 
 #ifdef NUI_HAS_STD_RANGES
 #    include <ranges>
@@ -21,6 +23,19 @@ namespace Nui
         class Element;
     }
 
+    /**
+     * @brief Options for rendering a range progressively, see ObservedRange::progressive.
+     */
+    struct ProgressiveRender
+    {
+        /// Amount of elements that are rendered immediately.
+        std::size_t initialCount{50};
+        /// Maximum amount of elements rendered per animation frame.
+        std::size_t chunkSize{500};
+        /// Stops rendering a chunk once this many milliseconds were spent in the frame. 0 disables the time check.
+        double frameBudget{8.0};
+    };
+
     template <typename Derived>
     class BasicObservedRange
     {
@@ -111,8 +126,36 @@ namespace Nui
             return observedValue_;
         }
 
+        /**
+         * @brief Renders only the first elements when the range is (re)rendered entirely and the remaining ones in
+         * chunks over the following animation frames. Changes to the range in between are applied to the already
+         * rendered elements, the rest picks them up when rendered.
+         *
+         * @code{.cpp}
+         * tbody{}(range(rows).progressive({.initialCount = 100}), [](long long, Row const& row) { ... })
+         * @endcode
+         */
+        ObservedRange& progressive(ProgressiveRender options = {}) &
+        requires isRandomAccess
+        {
+            progressive_ = options;
+            return *this;
+        }
+        ObservedRange&& progressive(ProgressiveRender options = {}) &&
+        requires isRandomAccess
+        {
+            progressive_ = options;
+            return std::move(*this);
+        }
+
+        std::optional<ProgressiveRender> const& progressiveRender() const
+        {
+            return progressive_;
+        }
+
       private:
         Detail::ObservedAddMutableReference_t<ObservedValue> observedValue_;
+        std::optional<ProgressiveRender> progressive_{};
     };
 
     template <typename CopyableRangeLike, typename... ObservedValues>
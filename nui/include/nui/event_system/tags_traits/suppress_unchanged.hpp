@@ -0,0 +1,40 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+namespace Nui
+{
+    /**
+     * @brief Tag for observed values that shall not activate their events when a value equal to the current one is
+     * assigned. Use as Observed<T, SuppressUnchanged> or within a TagContainer.
+     */
+    struct SuppressUnchanged
+    {
+        static constexpr bool suppressUnchanged = true;
+    };
+
+    /**
+     * @brief Specialize this for a type to suppress unchanged assignments of all observeds of that type.
+     */
+    template <typename T>
+    struct SuppressUnchangedAssignment : std::false_type
+    {};
+
+    namespace Detail
+    {
+        template <typename Tags>
+        concept HasSuppressUnchangedTag = requires {
+            requires static_cast<bool>(Tags::suppressUnchanged);
+        };
+
+        template <typename Tags, typename T>
+        concept HasMemberChangeTracking = requires(T const& lhs, T const& rhs) {
+            { Tags::changedMembers(lhs, rhs) } -> std::convertible_to<unsigned long long>;
+        };
+    }
+
+    template <typename T, typename Tags>
+    concept SuppressesUnchangedAssignment = std::equality_comparable<T> &&
+        (SuppressUnchangedAssignment<T>::value || Detail::HasSuppressUnchangedTag<Tags>);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <nui/event_system/tags_traits/suppress_unchanged.hpp>
+#include <nui/event_system/observed_value.hpp>
+#include <nui/event_system/listen.hpp>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#include <boost/describe.hpp>
+#include <boost/mp11/algorithm.hpp>
+#pragma clang diagnostic pop
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief Tag for observed boost described structs. Assigning a new value compares the members individually, does
+     * nothing when all are equal and otherwise remembers which members changed (see ModifiableObserved::memberChanged).
+     * Bindings to a single member can use this to skip work, see listenMember.
+     *
+     * Each described member maps to one bit, members beyond the 63rd share the last bit. Changes of base classes
+     * mark all members as changed. Types that are not described are compared as a whole.
+     */
+    struct TrackMemberChanges : SuppressUnchanged
+    {
+        static constexpr std::size_t maxTrackedMembers = 64;
+
+        static unsigned long long memberBitAt(std::size_t index)
+        {
+            return 1ULL << (index < maxTrackedMembers ? index : maxTrackedMembers - 1);
+        }
+
+        template <typename T>
+        static unsigned long long changedMembers(T const& lhs, T const& rhs)
+        {
+            if constexpr (boost::describe::has_describe_members<T>::value)
+            {
+                unsigned long long changed = 0;
+                if constexpr (boost::describe::has_describe_bases<T>::value)
+                {
+                    boost::mp11::mp_for_each<boost::describe::describe_bases<T, boost::describe::mod_any_access>>(
+                        [&](auto base) {
+                            using BaseType = typename decltype(base)::type;
+                            if (changedMembers<BaseType>(lhs, rhs) != 0)
+                                changed = ~0ULL;
+                        });
+                }
+
+                std::size_t index = 0;
+                boost::mp11::mp_for_each<boost::describe::describe_members<T, boost::describe::mod_any_access>>(
+                    [&](auto member) {
+                        if (!(lhs.*member.pointer == rhs.*member.pointer))
+                            changed |= memberBitAt(index);
+                        ++index;
+                    });
+                return changed;
+            }
+            else
+            {
+                return lhs == rhs ? 0ULL : ~0ULL;
+            }
+        }
+
+        template <typename T, typename MemberT>
+        static unsigned long long memberBit(MemberT T::* member)
+        {
+            unsigned long long bit = ~0ULL;
+            if constexpr (boost::describe::has_describe_members<T>::value)
+            {
+                std::size_t index = 0;
+                boost::mp11::mp_for_each<boost::describe::describe_members<T, boost::describe::mod_any_access>>(
+                    [&](auto descriptor) {
+                        if constexpr (std::is_same_v<std::remove_cv_t<decltype(descriptor.pointer)>, MemberT T::*>)
+                        {
+                            if (descriptor.pointer == member)
+                                bit = memberBitAt(index);
+                        }
+                        ++index;
+                    });
+            }
+            return bit;
+        }
+    };
+
+    /**
+     * @brief Like listen, but only calls onChange when the given member changed. Requires member change tracking on
+     * the observed (see TrackMemberChanges).
+     *
+     * @param obs The observed value.
+     * @param member The member to listen to.
+     * @param onChange Is called with the new value of the member.
+     * @return EventRegistry::EventIdType The id of the registered event.
+     */
+    template <typename ValueT, typename Tags, typename MemberT, typename FunctionT>
+    requires Detail::HasMemberChangeTracking<Tags, ValueT>
+    EventRegistry::EventIdType
+    listenMember(Observed<ValueT, Tags> const& obs, MemberT ValueT::* member, FunctionT onChange)
+    {
+        return listen(obs, [&obs, member, onChange = std::move(onChange)](ValueT const& value) {
+            if (obs.memberChanged(member))
+                onChange(value.*member);
+        });
+    }
+}
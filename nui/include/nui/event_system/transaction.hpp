@@ -0,0 +1,84 @@
+#pragma once
+
+#include <nui/event_system/event_context.hpp>
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief Batches modifications of observed values. While a transaction is alive, modified observeds do not
+     * activate their events, they are only recorded once. When the (outermost) transaction ends, every recorded
+     * observed activates its events a single time and pending event execution requests are performed.
+     */
+    class Transaction
+    {
+      public:
+        Transaction()
+            : Transaction{globalEventContext}
+        {}
+        explicit Transaction(EventContext& ctx)
+            : ctx_{&ctx}
+        {
+            ctx_->beginTransaction();
+        }
+        ~Transaction()
+        {
+            commit();
+        }
+        Transaction(Transaction const&) = delete;
+        Transaction& operator=(Transaction const&) = delete;
+        Transaction(Transaction&&) = delete;
+        Transaction& operator=(Transaction&&) = delete;
+
+        /**
+         * @brief Ends the transaction before the guard is destroyed. Has no effect when called twice.
+         */
+        void commit()
+        {
+            if (ctx_ == nullptr)
+                return;
+            auto* ctx = std::exchange(ctx_, nullptr);
+            ctx->endTransaction();
+        }
+
+      private:
+        EventContext* ctx_;
+    };
+
+    /**
+     * @brief Runs the given function within a transaction on the given event context.
+     *
+     * @return Whatever the function returns.
+     */
+    template <typename FunctionT>
+    requires std::invocable<FunctionT>
+    decltype(auto) transaction(EventContext& ctx, FunctionT&& func)
+    {
+        Transaction guard{ctx};
+        return std::invoke(std::forward<FunctionT>(func));
+    }
+
+    /**
+     * @brief Runs the given function within a transaction on the global event context.
+     *
+     * @code{.cpp}
+     * Nui::transaction([&]{
+     *     name = "Bob";
+     *     for (auto& item : items)
+     *         item.selected = false;
+     * });
+     * @endcode
+     *
+     * @return Whatever the function returns.
+     */
+    template <typename FunctionT>
+    requires std::invocable<FunctionT>
+    decltype(auto) transaction(FunctionT&& func)
+    {
+        return transaction(globalEventContext, std::forward<FunctionT>(func));
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <nui/frontend/api/intersection_observer_entry.hpp>
+#include <nui/frontend/val_wrapper.hpp>
+#include <nui/utility/move_detector.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Nui::WebApi
+{
+    /**
+     * @brief An intersection observer class, used for observing changes in the intersection of elements with an
+     * ancestor element or the viewport.
+     *
+     * @see https://developer.mozilla.org/en-US/docs/Web/API/IntersectionObserver/IntersectionObserver
+     */
+    class IntersectionObserver : public ValWrapper
+    {
+      public:
+        struct Options
+        {
+            /// The ancestor used as the viewport, the document viewport if not set.
+            std::optional<Nui::val> root{};
+            /// Margin around the root, e.g. "200px 0px", grows or shrinks the area that counts as intersecting.
+            std::string rootMargin{"0px"};
+            /// Ratios of visibility at which the callback is called, the browser default (0) if empty.
+            std::vector<double> thresholds{};
+        };
+
+        explicit IntersectionObserver(
+            std::function<void(std::vector<IntersectionObserverEntry> const&, IntersectionObserver const&)> callback);
+        IntersectionObserver(
+            std::function<void(std::vector<IntersectionObserverEntry> const&, IntersectionObserver const&)> callback,
+            Options const& options);
+        ~IntersectionObserver() override;
+        IntersectionObserver(IntersectionObserver const&) = delete;
+        IntersectionObserver(IntersectionObserver&&) noexcept = default;
+        IntersectionObserver& operator=(IntersectionObserver const&) = delete;
+        IntersectionObserver& operator=(IntersectionObserver&&) noexcept = default;
+
+        explicit IntersectionObserver(Nui::val event);
+
+        /**
+         * @brief Stops watching all of its target elements for visibility changes.
+         */
+        void disconnect() const;
+
+        /**
+         * @brief Adds an element to the set of target elements being watched by the IntersectionObserver.
+         */
+        void observe(Nui::val target) const;
+
+        /**
+         * @brief Instructs the IntersectionObserver to stop observing the specified target element.
+         */
+        void unobserve(Nui::val target) const;
+
+        /**
+         * @brief Returns the entries of all observed targets that were not yet passed to the callback.
+         */
+        std::vector<IntersectionObserverEntry> takeRecords() const;
+
+      private:
+        Nui::MoveDetector moveDetector_;
+        std::function<void(std::vector<IntersectionObserverEntry> const&, IntersectionObserver const&)> callback_;
+    };
+}
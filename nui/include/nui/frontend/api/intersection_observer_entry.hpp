@@ -0,0 +1,56 @@
+#pragma once
+
+#include <nui/frontend/api/dom_rect_readonly.hpp>
+#include <nui/frontend/val_wrapper.hpp>
+
+#include <optional>
+
+namespace Nui::WebApi
+{
+    /**
+     * @brief An IntersectionObserverEntry describes the intersection between the target element and its root container
+     * at a specific moment of transition.
+     *
+     * @see https://developer.mozilla.org/en-US/docs/Web/API/IntersectionObserverEntry
+     */
+    class IntersectionObserverEntry : public ValWrapper
+    {
+      public:
+        explicit IntersectionObserverEntry(Nui::val event);
+
+        /**
+         * @brief The bounds rectangle of the target element.
+         */
+        DomRectReadOnly boundingClientRect() const;
+
+        /**
+         * @brief The ratio of the intersectionRect to the boundingClientRect.
+         */
+        double intersectionRatio() const;
+
+        /**
+         * @brief The rectangle describing the visible area of the target.
+         */
+        DomRectReadOnly intersectionRect() const;
+
+        /**
+         * @brief True if the target element intersects with the root (plus root margin) of the observer.
+         */
+        bool isIntersecting() const;
+
+        /**
+         * @brief The rectangle of the root (plus root margin). Not set for cross origin targets.
+         */
+        std::optional<DomRectReadOnly> rootBounds() const;
+
+        /**
+         * @brief The element whose intersection with the root changed.
+         */
+        Nui::val target() const;
+
+        /**
+         * @brief The time at which the intersection was recorded, relative to the time origin of the document.
+         */
+        double time() const;
+    };
+}
@@ -20,6 +20,7 @@
 #include <nui/frontend/attributes/checked.hpp>
 #include <nui/frontend/attributes/cite.hpp>
 #include <nui/frontend/attributes/class.hpp>
+#include <nui/frontend/attributes/class_list.hpp>
 #include <nui/frontend/attributes/code.hpp>
 #include <nui/frontend/attributes/code_base.hpp>
 #include <nui/frontend/attributes/col_span.hpp>
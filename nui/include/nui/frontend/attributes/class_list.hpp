@@ -0,0 +1,167 @@
+#pragma once
+
+#include <nui/frontend/attributes/impl/attribute.hpp>
+#include <nui/frontend/attributes/impl/attribute_factory.hpp>
+#include <nui/frontend/dom/childless_element.hpp>
+#include <nui/event_system/observed_value.hpp>
+#include <nui/event_system/observed_value_combinator.hpp>
+#include <nui/frontend/val.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Nui::Attributes
+{
+    namespace Detail
+    {
+        template <typename T>
+        concept ClassTokenRange = std::ranges::input_range<T const> &&
+            std::convertible_to<std::ranges::range_reference_t<T const>, std::string_view>;
+
+        /**
+         * @brief Remembers which classes a classList binding has applied to an element, so that only tokens that
+         * were added or removed cause a DOM call. The string handles of applied classes are kept and reused.
+         */
+        class AppliedClassTokens
+        {
+          public:
+            /**
+             * @brief Records the tokens as applied without touching the DOM.
+             */
+            template <typename RangeT>
+            void assume(RangeT const& tokens)
+            {
+                for (auto const& token : tokens)
+                {
+                    std::string_view view{token};
+                    if (!view.empty())
+                        tokens_.try_emplace(std::string{view}, Token{.handle = Nui::val{std::string{view}}});
+                }
+            }
+
+            /**
+             * @brief Adds the tokens that are not yet applied and removes applied tokens that are missing.
+             */
+            template <typename RangeT>
+            void apply(Nui::val const& classList, RangeT const& tokens)
+            {
+                ++generation_;
+                for (auto const& token : tokens)
+                {
+                    std::string_view view{token};
+                    if (view.empty())
+                        continue;
+
+                    auto iter = tokens_.find(view);
+                    if (iter == tokens_.end())
+                    {
+                        iter = tokens_.emplace(std::string{view}, Token{.handle = Nui::val{std::string{view}}}).first;
+                        classList.call<void>("add", iter->second.handle);
+                    }
+                    iter->second.generation = generation_;
+                }
+
+                for (auto iter = tokens_.begin(); iter != tokens_.end();)
+                {
+                    if (iter->second.generation == generation_)
+                    {
+                        ++iter;
+                        continue;
+                    }
+                    classList.call<void>("remove", iter->second.handle);
+                    iter = tokens_.erase(iter);
+                }
+            }
+
+          private:
+            struct Token
+            {
+                Nui::val handle;
+                std::size_t generation{0};
+            };
+            struct StringHash
+            {
+                using is_transparent = void;
+                std::size_t operator()(std::string_view view) const
+                {
+                    return std::hash<std::string_view>{}(view);
+                }
+            };
+
+            std::unordered_map<std::string, Token, StringHash, std::equal_to<>> tokens_{};
+            std::size_t generation_{0};
+        };
+    }
+
+    /**
+     * @brief Binds a list of classes to the classList of an element. Unlike class_, which replaces the whole class
+     * string, changes are applied with classList.add/remove for the tokens that actually changed. Classes that are
+     * set through other means (e.g. "name"_class) are not touched.
+     *
+     * @code{.cpp}
+     * Observed<std::vector<std::string>> classes{{"row", "even"}};
+     * tr{classList = classes}()
+     * @endcode
+     */
+    struct classList_
+    {
+        template <typename T>
+        requires Detail::ClassTokenRange<T>
+        // NOLINTNEXTLINE(misc-unconventional-assign-operator, cppcoreguidelines-c-copy-assignment-signature)
+        Attribute operator=(T tokens) const
+        {
+            return Attribute{[tokens = std::move(tokens)](Dom::ChildlessElement& element) {
+                Detail::AppliedClassTokens{}.apply(element.val()["classList"], tokens);
+            }};
+        }
+
+        template <typename T>
+        requires Detail::ClassTokenRange<T>
+        // NOLINTNEXTLINE(misc-unconventional-assign-operator, cppcoreguidelines-c-copy-assignment-signature)
+        Attribute operator=(Observed<T>& obs) const
+        {
+            return bind(::Nui::Detail::CopyableObservedWrap{obs});
+        }
+
+        template <typename RendererType, typename... ObservedValues>
+        requires Detail::ClassTokenRange<
+            std::decay_t<decltype(std::declval<ObservedValueCombinatorWithGenerator<RendererType, ObservedValues...>>()
+                                      .value())>>
+        // NOLINTNEXTLINE(misc-unconventional-assign-operator, cppcoreguidelines-c-copy-assignment-signature)
+        Attribute
+        operator=(ObservedValueCombinatorWithGenerator<RendererType, ObservedValues...> const& combinator) const
+        {
+            return bind(combinator);
+        }
+
+      private:
+        template <typename SourceT>
+        static Attribute bind(SourceT const& source)
+        {
+            return Attribute{
+                [source](Dom::ChildlessElement& element) {
+                    Detail::AppliedClassTokens{}.apply(element.val()["classList"], source.value());
+                },
+                [source](std::weak_ptr<Dom::ChildlessElement>&& element) {
+                    // The setter has just applied the current value to this element.
+                    auto applied = std::make_shared<Detail::AppliedClassTokens>();
+                    applied->assume(source.value());
+                    return Detail::changeEventHandler(
+                        element, source, [source, applied](Dom::ChildlessElement& element) {
+                            applied->apply(element.val()["classList"], source.value());
+                            return true;
+                        });
+                },
+                [source](EventContext::EventIdType id) {
+                    source.detachEvent(id);
+                },
+            };
+        }
+    } static constexpr classList;
+}
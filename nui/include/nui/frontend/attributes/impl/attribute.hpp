@@ -3,14 +3,106 @@
 #include <nui/frontend/dom/element_fwd.hpp>
 #include <nui/event_system/event_context.hpp>
 
+#include <array>
+#include <concepts>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <variant>
 
 namespace Nui
 {
+    /**
+     * @brief An attribute with a constant value, e.g. class_ = "card". It is a literal type that holds a plain
+     * function pointer instead of type erased setters and can therefore be created at compile time and be applied
+     * without any allocation.
+     */
+    struct StaticAttribute
+    {
+        void (*apply)(Dom::ChildlessElement&, char const* name, char const* value);
+        char const* name;
+        char const* value;
+
+        void setOn(Dom::ChildlessElement& element) const
+        {
+            apply(element, name, value);
+        }
+    };
+
+    /**
+     * @brief A fixed size pack of static attributes. Meant to be stored in static constexpr variables and shared by
+     * all elements using it through attributePack, see staticAttributes.
+     */
+    template <std::size_t Count>
+    struct StaticAttributes
+    {
+        std::array<StaticAttribute, Count> attributes;
+    };
+
+    template <typename T>
+    struct IsStaticAttributesImpl
+    {
+        static constexpr bool value = false;
+    };
+    template <std::size_t Count>
+    struct IsStaticAttributesImpl<StaticAttributes<Count>>
+    {
+        static constexpr bool value = true;
+    };
+    template <typename T>
+    concept IsStaticAttributes = IsStaticAttributesImpl<T>::value;
+
+    /**
+     * @brief Creates a pack of static attributes, that elements can reference instead of copying attributes.
+     *
+     * @code{.cpp}
+     * static constexpr auto cardAttributes = staticAttributes(class_ = "card", "role"_attr = "listitem");
+     * // ...
+     * div{attributePack<cardAttributes>, onClick = select}()
+     * @endcode
+     */
+    template <typename... T>
+    requires(std::same_as<T, StaticAttribute> && ...)
+    constexpr StaticAttributes<sizeof...(T)> staticAttributes(T... attributes)
+    {
+        return StaticAttributes<sizeof...(T)>{.attributes = {attributes...}};
+    }
+
+    /**
+     * @brief Reference of an element to a static attribute pack. It can only be created from a pack given as template
+     * argument, see attributePack, so the compiler ensures that the pack has static storage duration.
+     */
+    class StaticAttributesRef
+    {
+      public:
+        template <auto const& Pack>
+        requires IsStaticAttributes<std::remove_cvref_t<decltype(Pack)>>
+        static constexpr StaticAttributesRef of()
+        {
+            return StaticAttributesRef{Pack.attributes};
+        }
+
+        constexpr std::span<StaticAttribute const> attributes() const
+        {
+            return attributes_;
+        }
+
+      private:
+        constexpr explicit StaticAttributesRef(std::span<StaticAttribute const> attributes)
+            : attributes_{attributes}
+        {}
+
+      private:
+        std::span<StaticAttribute const> attributes_;
+    };
+
+    /// Passes a static constexpr attribute pack to an element without copying it, see staticAttributes.
+    template <auto const& Pack>
+    inline constexpr StaticAttributesRef attributePack = StaticAttributesRef::of<Pack>();
+
     class Attribute
     {
       public:
@@ -24,6 +116,10 @@ namespace Nui
         };
 
         Attribute() = default;
+        // NOLINTNEXTLINE(hicpp-explicit-conversions): Static attributes are used in place of attributes.
+        Attribute(StaticAttribute attribute)
+            : attributeImpl_{attribute}
+        {}
         explicit Attribute(
             std::function<void(Dom::ChildlessElement&)> setter,
             std::function<EventContext::EventIdType(std::weak_ptr<Dom::ChildlessElement>&& element)> createEvent = {},
@@ -66,6 +162,7 @@ namespace Nui
         std::string stringData() const;
 
         bool isRegular() const;
+        bool isStatic() const;
         bool isStringData() const;
         bool defer() const;
         void defer(bool doDefer) &;
@@ -76,7 +173,7 @@ namespace Nui
         }
 
       private:
-        std::variant<std::monostate, RegularAttribute, StringDataAttribute> attributeImpl_{};
+        std::variant<std::monostate, RegularAttribute, StringDataAttribute, StaticAttribute> attributeImpl_{};
         std::function<EventContext::EventIdType(std::weak_ptr<Dom::ChildlessElement>&& element)> createEvent_{};
         std::function<void(EventContext::EventIdType const&)> clearEvent_{};
         bool defer_{false};
@@ -14,6 +14,7 @@
 #include <concepts>
 #include <memory>
 #include <functional>
+#include <utility>
 
 namespace Nui::Attributes
 {
@@ -106,6 +107,32 @@ namespace Nui::Attributes
             }
         };
 
+        /**
+         * @brief Policy for setting single CSS properties of the inline style of DOM elements.
+         */
+        struct SetStylePropertyPolicy
+        {
+            template <typename ValueT>
+            static void set(Dom::ChildlessElement& element, char const* name, ValueT&& value) noexcept(
+                noexcept(std::declval<Dom::ChildlessElement&>().setStyleProperty(name, std::forward<ValueT>(value))))
+            {
+                element.setStyleProperty(name, std::forward<ValueT>(value));
+            }
+        };
+
+        /**
+         * @brief Policy for adding or removing a single class of DOM elements.
+         */
+        struct SetClassTokenPolicy
+        {
+            template <typename ValueT>
+            static void set(Dom::ChildlessElement& element, char const* name, ValueT&& value) noexcept(
+                noexcept(std::declval<Dom::ChildlessElement&>().setClassToken(name, std::forward<ValueT>(value))))
+            {
+                element.setClassToken(name, std::forward<ValueT>(value));
+            }
+        };
+
         /**
          * @brief Policy for setting the value of a text node on DOM elements.
          */
@@ -119,6 +146,46 @@ namespace Nui::Attributes
         };
     }
 
+    namespace Detail
+    {
+        template <typename AccumulatorT>
+        struct FrameCoalescedState
+        {
+            AccumulatorT accumulator;
+            bool scheduled{false};
+            Nui::val frameCallback{Nui::val::undefined()};
+        };
+
+        /**
+         * @brief Creates a listener that folds native events into an accumulator and requests an animation frame on
+         * the first event after a delivery. The frame callback delivers the accumulator and resets it.
+         */
+        template <typename AccumulatorT, typename FoldT, typename FunctionT>
+        auto makeFrameCoalescedListener(AccumulatorT const& initial, FoldT fold, FunctionT func)
+        {
+            auto state = std::make_shared<FrameCoalescedState<AccumulatorT>>(FrameCoalescedState<AccumulatorT>{initial});
+            state->frameCallback = Nui::bind(
+                [weak = std::weak_ptr{state}, initial, func = std::move(func)](Nui::val const&) mutable {
+                    auto state = weak.lock();
+                    if (!state)
+                        return;
+                    state->scheduled = false;
+                    func(std::exchange(state->accumulator, initial));
+                    globalEventContext.executeActiveEventsImmediately();
+                },
+                std::placeholders::_1);
+
+            return [state, fold = std::move(fold)](Nui::val event) mutable {
+                fold(state->accumulator, std::move(event));
+                if (!state->scheduled)
+                {
+                    state->scheduled = true;
+                    Nui::val::global("requestAnimationFrame")(state->frameCallback);
+                }
+            };
+        }
+    }
+
     /**
      * @brief This is the class that is used to create attributes/properties for DOM elements. It uses a policy to
      * determine how the attribute should be applied to the element. The factory can be assigned a stateful variable to
@@ -150,6 +217,16 @@ namespace Nui::Attributes
             return name_;
         };
 
+        /**
+         * @brief Constant string values do not need any type erased state and create a StaticAttribute instead, which
+         * converts to Attribute and can be collected into staticAttributes packs at compile time.
+         */
+        // NOLINTNEXTLINE(misc-unconventional-assign-operator, cppcoreguidelines-c-copy-assignment-signature)
+        constexpr StaticAttribute operator=(char const* value) const
+        {
+            return StaticAttribute{.apply = &applyStatic, .name = name(), .value = value};
+        }
+
         template <typename U>
         requires(
             !IsObservedLike<std::decay_t<U>> && !std::invocable<U, Nui::val> &&
@@ -318,11 +395,18 @@ namespace Nui::Attributes
         }
 
       private:
+        static void applyStatic(Dom::ChildlessElement& element, char const* name, char const* value)
+        {
+            Policy::set(element, name, value);
+        }
+
         char const* name_;
     };
 
     using PropertyFactory = ElementMemberFactory<Detail::SetPropertyPolicy>;
     using AttributeFactory = ElementMemberFactory<Detail::SetAttributePolicy>;
+    using StylePropertyFactory = ElementMemberFactory<Detail::SetStylePropertyPolicy>;
+    using ClassTokenFactory = ElementMemberFactory<Detail::SetClassTokenPolicy>;
 
     /**
      * @brief The EventFactory is similar to the ElementMemberFactory but it can only be used for creating event
@@ -389,6 +473,56 @@ namespace Nui::Attributes
             };
         }
 
+        /**
+         * @brief Creates an event listener that delivers at most one event per animation frame. Only the latest native
+         * event since the last frame is passed to the function. Meant for high frequency events like scroll,
+         * mousemove, pointermove, input or resize.
+         *
+         * @code{.cpp}
+         * div{"scroll"_event.perFrame([](Nui::val event){ ... }, {.passive = true})}()
+         * @endcode
+         *
+         * @param func Called once per frame with the latest event.
+         * @param options Options for addEventListener, use passive for scroll and touch events.
+         */
+        Attribute perFrame(std::function<void(Nui::val)> func, Dom::EventListenerOptions options = {}) const
+        {
+            return accumulatePerFrame(
+                Nui::val::undefined(),
+                [](Nui::val& latest, Nui::val event) {
+                    latest = std::move(event);
+                },
+                std::move(func),
+                options);
+        }
+
+        /**
+         * @brief Creates an event listener that folds all native events of a frame into an accumulator and delivers it
+         * once per animation frame, e.g. to sum up wheel or movement deltas.
+         *
+         * @param initial The accumulator value at the beginning of each frame.
+         * @param fold Called for every native event with the accumulator and the event.
+         * @param func Called once per frame with the accumulated value.
+         * @param options Options for addEventListener.
+         */
+        template <typename AccumulatorT, typename FoldT, typename FunctionT>
+        requires(
+            std::invocable<FoldT&, AccumulatorT&, Nui::val> && std::invocable<FunctionT&, AccumulatorT> &&
+            std::copy_constructible<AccumulatorT>)
+        Attribute accumulatePerFrame(
+            AccumulatorT initial,
+            FoldT fold,
+            FunctionT func,
+            Dom::EventListenerOptions options = {}) const
+        {
+            return Attribute{
+                [name = name(), initial = std::move(initial), fold = std::move(fold), func = std::move(func), options](
+                    Dom::ChildlessElement& element) {
+                    element.addEventListener(name, Detail::makeFrameCoalescedListener(initial, fold, func), options);
+                },
+            };
+        }
+
       private:
         char const* name_;
     };
@@ -429,6 +563,38 @@ namespace Nui::Attributes
         {
             return EventFactory{name};
         }
+
+        /**
+         * @brief Creates a StylePropertyFactory for a single CSS property. Each such property is applied with
+         * style.setProperty and, when bound to an observed, only updated when that observed changes.
+         *
+         * @code{.cpp}
+         * div{"transform"_style = transform, "color"_style = "red"}()
+         * @endcode
+         *
+         * @param name The name of the CSS property (e.g. "transform", "background-color", "--custom").
+         * @return constexpr StylePropertyFactory
+         */
+        constexpr StylePropertyFactory operator""_style(char const* name, std::size_t)
+        {
+            return StylePropertyFactory{name};
+        }
+
+        /**
+         * @brief Creates a ClassTokenFactory for a single class. The class is added when the assigned (observed) bool
+         * is true and removed otherwise, other classes of the element are not touched.
+         *
+         * @code{.cpp}
+         * tr{"selected"_class = isSelected}()
+         * @endcode
+         *
+         * @param name The name of the class.
+         * @return constexpr ClassTokenFactory
+         */
+        constexpr ClassTokenFactory operator""_class(char const* name, std::size_t)
+        {
+            return ClassTokenFactory{name};
+        }
     }
 
     namespace Detail
@@ -442,7 +608,7 @@ namespace Nui::Attributes
             // NOLINTNEXTLINE(misc-unconventional-assign-operator, cppcoreguidelines-c-copy-assignment-signature)
             Attribute operator=(Args&&... args) const
             {
-                auto attr = factory.operator=(std::forward<Args>(args)...);
+                Attribute attr = factory.operator=(std::forward<Args>(args)...);
                 attr.defer(true);
                 return attr;
             };
@@ -458,6 +624,7 @@ namespace Nui::Attributes
     template <typename T>
     requires(
         std::is_same_v<std::decay_t<T>, AttributeFactory> || std::is_same_v<std::decay_t<T>, PropertyFactory> ||
+        std::is_same_v<std::decay_t<T>, StylePropertyFactory> || std::is_same_v<std::decay_t<T>, ClassTokenFactory> ||
         std::is_same_v<std::decay_t<T>, EventFactory>)
     constexpr Detail::DeferWrap<T> operator!(T&& factory)
     {
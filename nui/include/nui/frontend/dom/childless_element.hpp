@@ -11,6 +11,16 @@
 
 namespace Nui::Dom
 {
+    /**
+     * @brief Options passed to addEventListener.
+     */
+    struct EventListenerOptions
+    {
+        /// The listener never calls preventDefault, which lets the browser scroll without waiting for it.
+        bool passive{false};
+        bool capture{false};
+    };
+
     /**
      * @brief The basic element cannot have children and does not hold explicit ownership of them.
      * To represent an actual HtmlElement use the Element class.
@@ -83,6 +93,20 @@ namespace Nui::Dom
             element_.call<void>(
                 "addEventListener", Nui::val{std::string{event}}, Nui::bind(callback, std::placeholders::_1));
         }
+        void addEventListener(
+            std::string_view event,
+            std::invocable<Nui::val> auto&& callback,
+            EventListenerOptions const& options)
+        {
+            auto jsOptions = Nui::val::object();
+            jsOptions.set("passive", options.passive);
+            jsOptions.set("capture", options.capture);
+            element_.call<void>(
+                "addEventListener",
+                Nui::val{std::string{event}},
+                Nui::bind(callback, std::placeholders::_1),
+                jsOptions);
+        }
 
         // TODO: more overloads?
         void setAttribute(std::string_view key, std::string const& value)
@@ -149,6 +173,64 @@ namespace Nui::Dom
                 variant);
         }
 
+        /**
+         * @brief Sets a single CSS property through element.style.setProperty. Other properties of the inline style
+         * are not touched. An empty value removes the property.
+         */
+        void setStyleProperty(std::string_view name, std::string const& value)
+        {
+            if (value.empty())
+                element_["style"].call<Nui::val>("removeProperty", Nui::val{std::string{name}});
+            else
+                element_["style"].call<Nui::val>("setProperty", Nui::val{std::string{name}}, Nui::val{value});
+        }
+        void setStyleProperty(std::string_view name, std::string_view value)
+        {
+            setStyleProperty(name, std::string{value});
+        }
+        void setStyleProperty(std::string_view name, char const* value)
+        {
+            setStyleProperty(name, std::string{value});
+        }
+        template <typename T>
+        requires std::integral<T>
+        void setStyleProperty(std::string_view name, T value)
+        {
+            setStyleProperty(name, std::to_string(value));
+        }
+        template <typename T>
+        requires std::floating_point<T>
+        void setStyleProperty(std::string_view name, T value)
+        {
+            element_["style"].call<Nui::val>(
+                "setProperty", Nui::val{std::string{name}}, Nui::val{static_cast<double>(value)});
+        }
+        template <typename T>
+        void setStyleProperty(std::string_view name, std::optional<T> const& value)
+        {
+            if (value)
+                setStyleProperty(name, *value);
+            else
+                element_["style"].call<Nui::val>("removeProperty", Nui::val{std::string{name}});
+        }
+        template <typename... List>
+        void setStyleProperty(std::string_view name, std::variant<List...> const& variant)
+        {
+            std::visit(
+                [this, &name](auto const& value) {
+                    this->setStyleProperty(name, value);
+                },
+                variant);
+        }
+
+        /**
+         * @brief Adds or removes a single class through element.classList. Other classes are not touched.
+         */
+        void setClassToken(std::string_view name, bool present)
+        {
+            element_["classList"].call<Nui::val>(present ? "add" : "remove", Nui::val{std::string{name}});
+        }
+
         void setNodeValue(std::string_view value)
         {
             element_.set("nodeValue", Nui::val{std::string{value}});
@@ -12,6 +12,8 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <iterator>
+#include <memory_resource>
 
 namespace Nui::Dom
 {
@@ -194,9 +196,14 @@ namespace Nui::Dom
          */
         void setup(HtmlElement const& element)
         {
-            std::vector<std::function<void()>> eventClearers;
+            // The collections are only needed during the setup, the kept ones are copied out at the end.
+            FrameArena::Scope arenaScope{globalEventContext.frameArena()};
+            std::pmr::vector<std::function<void()>> eventClearers{globalEventContext.frameArena().resource()};
             eventClearers.reserve(element.attributes().size());
-            std::vector<std::size_t> deferredIndices;
+            std::pmr::vector<std::size_t> deferredIndices{globalEventContext.frameArena().resource()};
+
+            for (auto const& attribute : element.staticAttributes())
+                attribute.setOn(*this);
 
             for (std::size_t i = 0; i != element.attributes().size(); ++i)
             {
@@ -207,7 +214,7 @@ namespace Nui::Dom
                     deferredIndices.push_back(i);
                     continue;
                 }
-                if (attribute.isRegular())
+                if (attribute.isRegular() || attribute.isStatic())
                     attribute.setOn(*this);
 
                 auto clear = attribute.getEventClear();
@@ -224,8 +231,9 @@ namespace Nui::Dom
             }
             if (!eventClearers.empty())
             {
-                eventClearers.shrink_to_fit();
-                unsetup_ = [eventClearers = std::move(eventClearers)]() {
+                unsetup_ = [eventClearers = std::vector<std::function<void()>>(
+                                std::make_move_iterator(eventClearers.begin()),
+                                std::make_move_iterator(eventClearers.end()))]() {
                     for (auto const& clear : eventClearers)
                         clear();
                 };
@@ -237,7 +245,10 @@ namespace Nui::Dom
 
             if (!deferredIndices.empty())
             {
-                deferredSetup_ = [this, deferredIndices = std::move(deferredIndices)](HtmlElement const& element) {
+                deferredSetup_ = [this,
+                                  deferredIndices =
+                                      std::vector<std::size_t>(deferredIndices.begin(), deferredIndices.end())](
+                                     HtmlElement const& element) {
                     std::vector<std::function<void()>> eventClearers;
                     eventClearers.reserve(deferredIndices.size());
 
@@ -245,7 +256,7 @@ namespace Nui::Dom
                     {
                         auto const& attribute = element.attributes()[index];
 
-                        if (attribute.isRegular())
+                        if (attribute.isRegular() || attribute.isStatic())
                             attribute.setOn(*this);
 
                         auto clear = attribute.getEventClear();
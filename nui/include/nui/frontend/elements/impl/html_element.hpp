@@ -18,6 +18,7 @@
 #include <nui/frontend/val.hpp>
 
 #include <vector>
+#include <span>
 #include <utility>
 #include <concepts>
 #include <memory>
@@ -77,15 +78,35 @@ namespace Nui
             , attributes_{std::move(attributes)}
         {}
         template <typename... T>
+        requires((!IsStaticAttributes<std::decay_t<T>> && !std::same_as<std::decay_t<T>, StaticAttributesRef>) && ...)
         HtmlElement(char const* name, HtmlElementBridge const* bridge, T&&... attributes)
             : name_{name}
             , bridge_{bridge}
             , attributes_{std::forward<T>(attributes)...}
         {}
 
+        /**
+         * @brief The static attributes are referenced and not copied. StaticAttributesRef can only refer to packs with
+         * static storage duration, so they outlive the element.
+         */
+        template <typename... T>
+        HtmlElement(
+            char const* name,
+            HtmlElementBridge const* bridge,
+            StaticAttributesRef staticAttributes,
+            T&&... attributes)
+            : name_{name}
+            , bridge_{bridge}
+            , staticAttributes_{staticAttributes.attributes()}
+            , attributes_{std::forward<T>(attributes)...}
+        {}
+        /// Packs have to be passed as attributePack<pack>, a pack that is not static would dangle.
+        template <std::size_t Count, typename... T>
+        HtmlElement(char const*, HtmlElementBridge const*, StaticAttributes<Count> const&, T&&...) = delete;
+
         HtmlElement clone() const
         {
-            return {name_, bridge_, attributes_};
+            return *this;
         }
 
       private:
@@ -220,7 +241,8 @@ namespace Nui
                         std::forward<RangeType>(valueRange).underlying(),
                         std::forward<GeneratorT>(elementRenderer),
                         valueRange.ejectBefore(),
-                        valueRange.ejectAfter())](auto& parentElement, Renderer const& gen) mutable {
+                        valueRange.ejectAfter(),
+                        valueRange.progressiveRender())](auto& parentElement, Renderer const& gen) mutable {
                 if (gen.type == RendererType::Inplace)
                     throw std::runtime_error("fragments are not supported for range generators");
 
@@ -406,6 +428,11 @@ namespace Nui
             return attributes_;
         }
 
+        std::span<StaticAttribute const> staticAttributes() const
+        {
+            return staticAttributes_;
+        }
+
         char const* name() const
         {
             return name_;
@@ -419,6 +446,7 @@ namespace Nui
       private:
         char const* name_;
         HtmlElementBridge const* bridge_;
+        std::span<StaticAttribute const> staticAttributes_{};
         std::vector<Attribute> attributes_;
     };
 }
\ No newline at end of file
@@ -6,8 +6,14 @@
 #include <nui/utility/scope_exit.hpp>
 #include <nui/utility/overloaded.hpp>
 #include <nui/utility/reverse_view.hpp>
+#include <nui/frontend/utility/functions.hpp>
+#include <nui/frontend/val.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace Nui::Detail
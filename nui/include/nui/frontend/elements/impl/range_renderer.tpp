@@ -36,10 +36,12 @@ namespace Nui::Detail
             ObservedAddMutableReference_t<ObservedType>&& observed,
             Generator&& elementRenderer,
             RendererVector&& before,
-            RendererVector&& after)
+            RendererVector&& after,
+            std::optional<ProgressiveRender> progressive = std::nullopt)
             : elementRenderer_{std::forward<GeneratorT>(elementRenderer)}
             , before_{std::move(before)}
             , after_{std::move(after)}
+            , progressive_{progressive}
             , valueRange_{std::forward<ObservedAddMutableReference_t<ObservedType>>(observed)}
         {}
         virtual ~BasicObservedRenderer() = default;
@@ -92,9 +94,18 @@ namespace Nui::Detail
                     parent->appendElements(before_);
                 renderedBeforeCount_ = parent->childCount();
 
+                // When rendering progressively, only the first elements are rendered here.
+                const auto limit =
+                    progressive_ ? progressive_->initialCount : std::numeric_limits<std::size_t>::max();
                 long long counter = 0;
                 for (auto& element : valueRange->value())
+                {
+                    if (static_cast<std::size_t>(counter) == limit)
+                        break;
                     elementRenderer_(counter++, element)(*parent, Renderer{.type = RendererType::Append});
+                }
+                renderedCount_ = static_cast<std::size_t>(counter);
+                remainderPending_ = renderedCount_ < valueRange->value().size();
                 ownContext().reset();
 
                 if (!after_.empty())
@@ -122,6 +133,10 @@ namespace Nui::Detail
         RendererVector before_;
         RendererVector after_;
         std::size_t renderedBeforeCount_{0};
+        std::optional<ProgressiveRender> progressive_;
+        // Amount of rendered range elements, which are always the first ones.
+        std::size_t renderedCount_{0};
+        bool remainderPending_{false};
         std::shared_ptr<RangeEventContext> ownContext_{std::make_shared<RangeEventContext>()};
 
       private:
@@ -143,6 +158,9 @@ namespace Nui::Detail
         using BasicObservedRenderer<RangeT, GeneratorT>::before_;
         using BasicObservedRenderer<RangeT, GeneratorT>::after_;
         using BasicObservedRenderer<RangeT, GeneratorT>::renderedBeforeCount_;
+        using BasicObservedRenderer<RangeT, GeneratorT>::progressive_;
+        using BasicObservedRenderer<RangeT, GeneratorT>::renderedCount_;
+        using BasicObservedRenderer<RangeT, GeneratorT>::remainderPending_;
 
         void insertions(auto& parent)
         {
@@ -155,11 +173,16 @@ namespace Nui::Detail
             {
                 for (auto r = i->low(), high = i->high(); r <= high; ++r)
                 {
+                    // Elements behind the rendered ones are rendered by the next chunks.
+                    if (remainderPending_ && static_cast<std::size_t>(r) >= renderedCount_)
+                        return;
+
                     elementRenderer_(r, valueRange->value()[static_cast<std::size_t>(r)])(
                         *parent,
                         Renderer{
                             .type = RendererType::Insert,
                             .metadata = static_cast<std::size_t>(r) + renderedBeforeCount_});
+                    ++renderedCount_;
                 }
             }
         }
@@ -175,8 +198,10 @@ namespace Nui::Detail
             {
                 using RangeValueType = typename std::decay_t<decltype(range)>::value_type;
                 const auto clampedLow = std::max(range.low(), RangeValueType{0});
-                const auto clampedHigh =
-                    std::min(range.high(), static_cast<RangeValueType>(valueRange->value().size()) - RangeValueType{1});
+                const auto clampedHigh = std::min(
+                    range.high(),
+                    static_cast<RangeValueType>(std::min(valueRange->value().size(), renderedCount_)) -
+                        RangeValueType{1});
                 if (clampedLow > clampedHigh)
                     continue;
                 for (auto r = clampedLow, high = clampedHigh; r <= high; ++r)
@@ -197,12 +222,74 @@ namespace Nui::Detail
 
             for (auto const& eraseRange : reverse_view{ownContext()})
             {
+                using RangeValueType = typename std::decay_t<decltype(eraseRange)>::value_type;
+                const auto clampedHigh =
+                    std::min(eraseRange.high(), static_cast<RangeValueType>(renderedCount_) - RangeValueType{1});
+                if (eraseRange.low() > clampedHigh)
+                    continue;
                 parent->erase(
                     begin(*parent) + eraseRange.low() + renderedBeforeCount_,
-                    begin(*parent) + eraseRange.high() + 1 + renderedBeforeCount_);
+                    begin(*parent) + clampedHigh + 1 + renderedBeforeCount_);
+                renderedCount_ -= static_cast<std::size_t>(clampedHigh - eraseRange.low() + 1);
             }
         }
 
+        /**
+         * @brief Renders the next chunk of a progressive render and requests another frame if elements remain.
+         */
+        void renderChunk()
+        {
+            chunkRequested_ = false;
+            auto parent = weakMaterialized_.lock();
+            if (!parent || !remainderPending_)
+                return;
+
+            auto valueRangeHolder = CommonHoldToken<RangeT>{};
+            auto* valueRange = getValueRange(valueRangeHolder);
+            if (valueRange == nullptr)
+                return;
+
+            // Changes that were not yet applied refer to indices of the rendered elements, so they go first.
+            if (ownContext().isInDefaultState())
+            {
+                auto& values = valueRange->value();
+                const auto now = []() {
+                    return Nui::val::global("performance").call<Nui::val>("now").as<double>();
+                };
+                const auto start = progressive_->frameBudget > 0 ? now() : 0.;
+                for (std::size_t chunk = 0; chunk != progressive_->chunkSize && renderedCount_ < values.size(); ++chunk)
+                {
+                    elementRenderer_(static_cast<long long>(renderedCount_), values[renderedCount_])(
+                        *parent,
+                        Renderer{.type = RendererType::Insert, .metadata = renderedCount_ + renderedBeforeCount_});
+                    ++renderedCount_;
+                    if (progressive_->frameBudget > 0 && now() - start >= progressive_->frameBudget)
+                        break;
+                }
+                remainderPending_ = renderedCount_ < values.size();
+            }
+
+            if (remainderPending_)
+                requestChunk();
+        }
+
+        void requestChunk()
+        {
+            if (chunkRequested_)
+                return;
+            chunkRequested_ = true;
+            if (frameCallback_.isUndefined())
+            {
+                frameCallback_ = Nui::bind(
+                    [weak = this->weak_from_this()](Nui::val const&) {
+                        if (auto self = weak.lock(); self)
+                            self->renderChunk();
+                    },
+                    std::placeholders::_1);
+            }
+            Nui::val::global("requestAnimationFrame")(frameCallback_);
+        }
+
         bool updateChildren(bool initial) override
         {
             auto parent = weakMaterialized_.lock();
@@ -216,7 +303,11 @@ namespace Nui::Detail
 
             // Regenerate all elements if necessary:
             if (fullRangeUpdate(parent, initial))
+            {
+                if (remainderPending_)
+                    requestChunk();
                 return KeepRange;
+            }
 
             switch (ownContext().operationType())
             {
@@ -258,6 +349,10 @@ namespace Nui::Detail
                 updateChildren(true);
             }
         }
+
+      private:
+        Nui::val frameCallback_{Nui::val::undefined()};
+        bool chunkRequested_{false};
     };
 
     template <typename RangeT, typename GeneratorT>
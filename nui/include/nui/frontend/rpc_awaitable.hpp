@@ -0,0 +1,255 @@
+#pragma once
+
+#include <nui/frontend/rpc_client.hpp>
+#include <nui/frontend/rpc_schema_codec.hpp>
+#include <nui/frontend/utility/task.hpp>
+#include <nui/frontend/utility/functions.hpp>
+#include <nui/frontend/utility/val_conversion.hpp>
+#include <nui/frontend/val.hpp>
+#include <nui/shared/rpc_request_error.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace Nui
+{
+    namespace Detail
+    {
+        struct RpcRequestState
+        {
+            std::optional<Nui::val> reply{};
+            std::exception_ptr error{};
+            std::coroutine_handle<> waiter{};
+            bool done{false};
+        };
+
+        inline void completeRpcRequest(std::shared_ptr<RpcRequestState> const& state)
+        {
+            state->done = true;
+            if (!state->waiter)
+                return;
+
+            // Resume on the next turn of the event loop, not from within the reply callback.
+            Nui::val::global().call<void>(
+                "setTimeout",
+                Nui::bind([state]() {
+                    std::exchange(state->waiter, nullptr).resume();
+                }),
+                0);
+        }
+    }
+
+    /**
+     * @brief A request to the backend that is already in flight and can be awaited in a Task. The backend function
+     * replies to its first argument, as with RpcClient::request.
+     *
+     * @tparam T The type the reply is converted to, Nui::val for the raw reply or void to ignore it.
+     * @tparam PositionalT The reply is positionally encoded, as the results of typed rpc functions are.
+     */
+    template <typename T, bool PositionalT = false>
+    class RpcAwaitable
+    {
+      public:
+        RpcAwaitable(std::shared_ptr<Detail::RpcRequestState> state, RpcClient::PendingCall pendingCall)
+            : state_{std::move(state)}
+            , pendingCall_{pendingCall}
+        {}
+
+        /**
+         * @brief Drops the pending call, an awaiting coroutine resumes with an RpcRequestError.
+         *
+         * @return true if the call was still pending.
+         */
+        bool cancel()
+        {
+            if (!pendingCall_.cancel())
+                return false;
+            state_->error = std::make_exception_ptr(RpcRequestError{"Rpc request was cancelled."});
+            Detail::completeRpcRequest(state_);
+            return true;
+        }
+
+        RpcClient::PendingCall const& pendingCall() const
+        {
+            return pendingCall_;
+        }
+
+        bool await_ready() const noexcept
+        {
+            return state_->done;
+        }
+        void await_suspend(std::coroutine_handle<> waiter) noexcept
+        {
+            state_->waiter = waiter;
+        }
+        T await_resume() const
+        {
+            if (state_->error)
+                std::rethrow_exception(state_->error);
+            if constexpr (std::is_same_v<T, Nui::val>)
+                return *state_->reply;
+            else if constexpr (PositionalT && !std::is_void_v<T>)
+                return Detail::fromRpcVal<T>(*state_->reply);
+            else if constexpr (!std::is_void_v<T>)
+            {
+                T value;
+                convertFromVal(*state_->reply, value);
+                return value;
+            }
+        }
+
+      private:
+        std::shared_ptr<Detail::RpcRequestState> state_;
+        RpcClient::PendingCall pendingCall_;
+    };
+
+    namespace Detail
+    {
+        template <bool PositionalT, typename T, typename... ArgsT>
+        RpcAwaitable<T, PositionalT>
+        makeRpcRequest(std::string name, RpcClient::RequestOptions options, ArgsT&&... args)
+        {
+            auto state = std::make_shared<Detail::RpcRequestState>();
+            options.onTimeout = [state, onTimeout = std::move(options.onTimeout)]() {
+                if (onTimeout)
+                    onTimeout();
+                state->error = std::make_exception_ptr(RpcRequestError{"Rpc request timed out."});
+                Detail::completeRpcRequest(state);
+            };
+
+            auto pendingCall = RpcClient::request(
+                name,
+                options,
+                [state](Nui::val reply) {
+                    state->reply = std::move(reply);
+                    Detail::completeRpcRequest(state);
+                },
+                std::forward<ArgsT>(args)...);
+
+            if (pendingCall.id() == 0)
+            {
+                state->error =
+                    std::make_exception_ptr(RpcRequestError{"Rpc request to '" + name + "' could not be made."});
+                state->done = true;
+            }
+            return RpcAwaitable<T, PositionalT>{std::move(state), pendingCall};
+        }
+
+        template <typename SchemaT, std::size_t... Is, typename... ArgsT>
+        auto makeRpcSchemaRequest(RpcClient::RequestOptions options, std::index_sequence<Is...>, ArgsT&&... args)
+        {
+            return makeRpcRequest<true, typename SchemaT::ReturnType>(
+                SchemaT::name,
+                std::move(options),
+                toRpcVal<std::tuple_element_t<Is, typename SchemaT::ArgsTuple>>(std::forward<ArgsT>(args))...);
+        }
+    }
+
+    /**
+     * @brief Sends a request to the backend right away and returns an awaitable for its reply. Requests that are
+     * created before any of them is awaited run concurrently.
+     *
+     * @code{.cpp}
+     * Nui::Task<> save()
+     * {
+     *     const auto path = co_await rpcRequest<std::string>("showSaveDialog", {.timeout = 60s});
+     *     co_await rpcRequest<void>("writeFile", path, content);
+     * }
+     * @endcode
+     *
+     * @param name Name of the backend function.
+     * @param options Timeout of the request, onTimeout is called before the awaiting coroutine resumes.
+     * @param args Arguments passed after the back channel.
+     */
+    template <typename T, typename... ArgsT>
+    requires(!RpcSchemaType<T>)
+    RpcAwaitable<T> rpcRequest(std::string name, RpcClient::RequestOptions options, ArgsT&&... args)
+    {
+        return Detail::makeRpcRequest<false, T>(std::move(name), std::move(options), std::forward<ArgsT>(args)...);
+    }
+
+    template <typename T, typename... ArgsT>
+    requires(!RpcSchemaType<T> && (!std::is_same_v<std::decay_t<ArgsT>, RpcClient::RequestOptions> && ...))
+    RpcAwaitable<T> rpcRequest(std::string name, ArgsT&&... args)
+    {
+        return rpcRequest<T>(std::move(name), RpcClient::RequestOptions{}, std::forward<ArgsT>(args)...);
+    }
+
+    /**
+     * @brief Sends a request to a typed backend function declared with NUI_RPC, the awaitable returns the result type
+     * of the schema.
+     *
+     * @code{.cpp}
+     * NUI_RPC(readDirectory, std::vector<FileEntry>(std::string const& path, bool recursive));
+     * // ...
+     * const auto entries = co_await rpcRequest<readDirectory>({.timeout = 5s}, "/home", false);
+     * @endcode
+     */
+    template <RpcSchemaType SchemaT, typename... ArgsT>
+    requires RpcSchemaArguments<SchemaT, ArgsT...>
+    auto rpcRequest(RpcClient::RequestOptions options, ArgsT&&... args)
+    {
+        return Detail::makeRpcSchemaRequest<SchemaT>(
+            std::move(options), std::index_sequence_for<ArgsT...>{}, std::forward<ArgsT>(args)...);
+    }
+
+    template <RpcSchemaType SchemaT, typename... ArgsT>
+    requires RpcSchemaArguments<SchemaT, ArgsT...>
+    auto rpcRequest(ArgsT&&... args)
+    {
+        return rpcRequest<SchemaT>(RpcClient::RequestOptions{}, std::forward<ArgsT>(args)...);
+    }
+
+    namespace Detail
+    {
+        template <typename AwaitableT>
+        using WhenAllResult = std::conditional_t<
+            std::is_void_v<decltype(std::declval<AwaitableT&>().await_resume())>,
+            std::monostate,
+            std::decay_t<decltype(std::declval<AwaitableT&>().await_resume())>>;
+
+        /// Awaits the awaitable and yields std::monostate in place of a void result.
+        template <typename AwaitableT>
+        struct WhenAllAwaiter
+        {
+            AwaitableT& awaitable;
+
+            bool await_ready()
+            {
+                return awaitable.await_ready();
+            }
+            auto await_suspend(std::coroutine_handle<> waiter)
+            {
+                return awaitable.await_suspend(waiter);
+            }
+            WhenAllResult<AwaitableT> await_resume()
+            {
+                if constexpr (std::is_same_v<WhenAllResult<AwaitableT>, std::monostate>)
+                {
+                    awaitable.await_resume();
+                    return {};
+                }
+                else
+                    return awaitable.await_resume();
+            }
+        };
+    }
+
+    /**
+     * @brief Awaits all given awaitables, e.g. RpcAwaitables or Tasks, and returns their results in order. Since
+     * requests and tasks are started on creation, they all run concurrently. Void results are std::monostate.
+     */
+    template <typename... AwaitablesT>
+    Task<std::tuple<Detail::WhenAllResult<AwaitablesT>...>> whenAll(AwaitablesT... awaitables)
+    {
+        co_return std::tuple<Detail::WhenAllResult<AwaitablesT>...>{
+            co_await Detail::WhenAllAwaiter<AwaitablesT>{awaitables}...};
+    }
+}
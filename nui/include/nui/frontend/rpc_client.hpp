@@ -6,13 +6,20 @@
 #include <nui/frontend/api/console.hpp>
 #include <nui/frontend/utility/functions.hpp>
 #include <nui/frontend/utility/val_conversion.hpp>
+#include <nui/frontend/rpc_schema_codec.hpp>
 #include <nui/shared/on_destroy.hpp>
+#include <nui/shared/rpc_schema.hpp>
 
 #include <fmt/format.h>
 
+#include <chrono>
+#include <functional>
+#include <optional>
 #include <string>
 #include <cstdint>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Nui
 {
@@ -167,6 +174,35 @@ namespace Nui
             mutable bool isSet_;
         };
 
+        /**
+         * @brief Queues calls to the backend and posts them as a single message after the current task, or after the
+         * given delay. The order of calls is preserved, the backend still handles each call on its own.
+         *
+         * @param delay Time to collect calls for, 0 posts them when the current task is done.
+         */
+        static void enableBatching(std::chrono::milliseconds delay = std::chrono::milliseconds{0})
+        {
+            using namespace std::string_literals;
+            if (Nui::val::global("nui_rpc").isUndefined())
+            {
+                WebApi::Console::error("rpc was not setup by backend"s);
+                return;
+            }
+            Nui::val batching = Nui::val::object();
+            batching.set("delay", static_cast<int>(delay.count()));
+            Nui::val::global("nui_rpc").set("batching", batching);
+        }
+
+        /**
+         * @brief Posts calls to the backend directly again. Already queued calls are sent first.
+         */
+        static void disableBatching()
+        {
+            if (Nui::val::global("nui_rpc").isUndefined())
+                return;
+            Nui::val::global("nui_rpc").set("batching", Nui::val::undefined());
+        }
+
         /**
          * @brief Get a callable remote function.
          *
@@ -191,6 +227,22 @@ namespace Nui
             return getRemoteCallable(std::move(name))(std::forward<ArgsT>(args)...);
         }
 
+        /**
+         * @brief Calls a typed backend function declared with NUI_RPC. Use rpcRequest for functions with a result.
+         *
+         * @param args Arguments, converted to the types of the schema.
+         */
+        template <RpcSchemaType SchemaT, typename... ArgsT>
+        requires RpcSchemaArguments<SchemaT, ArgsT...>
+        static void call(ArgsT&&... args)
+        {
+            static_assert(
+                std::is_void_v<typename SchemaT::ReturnType>,
+                "The rpc schema has a result, use rpcRequest to receive it.");
+            callSchema<typename SchemaT::ArgsTuple>(
+                SchemaT::name, std::index_sequence_for<ArgsT...>{}, std::forward<ArgsT>(args)...);
+        }
+
         /**
          * @brief Get a callable remote function and call it immediately with a callback.
          *
@@ -207,13 +259,162 @@ namespace Nui
         }
 
         /**
-         * @brief Get a callable remote function and register a temporary callable for a response.
+         * @brief Get a callable remote function and register a pending call for the response.
          */
         template <typename FunctionT>
         static auto getRemoteCallableWithBackChannel(std::string name, FunctionT&& func)
         {
-            auto tempFn = registerFunctionOnce(std::forward<FunctionT>(func), name);
-            return RemoteCallable{std::move(name), std::move(tempFn)};
+            auto pending = registerReply(std::forward<FunctionT>(func));
+            return RemoteCallable{std::move(name), pending.backChannel()};
+        }
+
+        struct RequestOptions
+        {
+            /// Time after which the pending call is dropped and onTimeout is called, 0 waits forever.
+            std::chrono::milliseconds timeout{0};
+            /// Called when the timeout passed without a reply.
+            std::function<void()> onTimeout{};
+            /// An AbortSignal that cancels the call, only used by requestAsync.
+            std::optional<Nui::val> signal{};
+        };
+
+        /**
+         * @brief A call that waits for a reply in the pending call table of the frontend.
+         */
+        class PendingCall
+        {
+          public:
+            PendingCall()
+                : id_{0}
+            {}
+            explicit PendingCall(std::uint32_t id)
+                : id_{id}
+            {}
+
+            /// The id of the call, 0 if the call could not be made.
+            std::uint32_t id() const
+            {
+                return id_;
+            }
+
+            /// The name the backend replies to.
+            std::string backChannel() const
+            {
+                return "reply_" + std::to_string(id_);
+            }
+
+            /// Returns true while the call neither got a reply, timed out nor was cancelled.
+            bool isPending() const
+            {
+                return id_ != 0 && Nui::val::global("nui_rpc").call<Nui::val>("isPending", id_).as<bool>();
+            }
+
+            /// Drops the pending call, a later reply is ignored. Returns true if the call was still pending.
+            bool cancel() const
+            {
+                return id_ != 0 && Nui::val::global("nui_rpc").call<Nui::val>("cancel", id_).as<bool>();
+            }
+
+          private:
+            std::uint32_t id_;
+        };
+
+        /**
+         * @brief Registers a callback in the pending call table. Pass the backChannel of the result as the first
+         * argument of a remote call, the backend then replies by id.
+         *
+         * @param func Called with the reply.
+         * @param options Timeout of the call.
+         * @return PendingCall A handle that can cancel the call.
+         */
+        template <typename FunctionT>
+        static PendingCall registerReply(FunctionT&& func, RequestOptions const& options = {})
+        {
+            using namespace std::string_literals;
+            if (Nui::val::global("nui_rpc").isUndefined())
+            {
+                WebApi::Console::error("rpc was not setup by backend"s);
+                return PendingCall{};
+            }
+            Nui::val id = Nui::val::global("nui_rpc").call<Nui::val>(
+                "request",
+                Nui::bind(
+                    [funcInner = Detail::FunctionWrapper<FunctionT>::wrapFunction(std::forward<FunctionT>(func))](
+                        Nui::val param) mutable {
+                        try
+                        {
+                            funcInner(param);
+                        }
+                        catch (std::exception const& exc)
+                        {
+                            // If you see this, never let an exception bubble up from your rpc function!
+                            WebApi::Console::error("Caught exception leaving rpc reply: {}", exc.what());
+                        }
+                        catch (...)
+                        {
+                            // If you see this, never let an exception bubble up from your rpc function!
+                            WebApi::Console::error("Caught unknown exception leaving rpc reply");
+                        }
+                    },
+                    std::placeholders::_1),
+                static_cast<int>(options.timeout.count()),
+                options.onTimeout ? Nui::bind(options.onTimeout) : Nui::val::undefined());
+            return PendingCall{id.as<std::uint32_t>()};
+        }
+
+        /**
+         * @brief Calls a remote function that replies to its first argument, the reply is passed to onReply.
+         *
+         * @param name Name of the function.
+         * @param options Timeout of the call.
+         * @param onReply Called with the reply.
+         * @param args Arguments to pass to the function.
+         * @return PendingCall A handle that can cancel the call.
+         */
+        template <typename FunctionT, typename... ArgsT>
+        static PendingCall
+        request(std::string name, RequestOptions const& options, FunctionT&& onReply, ArgsT&&... args)
+        {
+            using namespace std::string_literals;
+            RemoteCallable callable{name};
+            if (!callable)
+            {
+                WebApi::Console::error("Remote callable with name '"s + name + "' is undefined");
+                return PendingCall{};
+            }
+            auto pending = registerReply(std::forward<FunctionT>(onReply), options);
+            RemoteCallable{std::move(name), pending.backChannel()}(std::forward<ArgsT>(args)...);
+            return pending;
+        }
+
+        /**
+         * @brief Calls a remote function that replies to its first argument.
+         *
+         * @param name Name of the function.
+         * @param options Timeout and AbortSignal of the call.
+         * @param args Arguments to pass to the function.
+         * @return Nui::val A promise of the reply, rejected on timeout or when the signal aborts.
+         */
+        template <typename... ArgsT>
+        static Nui::val requestAsync(std::string name, RequestOptions const& options, ArgsT&&... args)
+        {
+            using namespace std::string_literals;
+            if (Nui::val::global("nui_rpc").isUndefined())
+                return Nui::val::global("Promise").call<Nui::val>("reject", "rpc was not setup by backend"s);
+            return Nui::val::global("nui_rpc").call<Nui::val>(
+                "requestPromise",
+                Nui::bind(
+                    [name = std::move(name), arguments = std::make_tuple(convertToVal(args)...)](Nui::val backChannel) {
+                        RemoteCallable callable{name, backChannel.as<std::string>()};
+                        std::apply(
+                            [&callable](auto const&... values) {
+                                callable(values...);
+                            },
+                            arguments);
+                    },
+                    std::placeholders::_1),
+                static_cast<int>(options.timeout.count()),
+                options.signal ? *options.signal : Nui::val::undefined());
         }
 
         /**
@@ -261,6 +462,18 @@ namespace Nui
             return tempIdString;
         }
 
+        /**
+         * @brief Answers a request of RpcHub::request from the backend.
+         *
+         * @param requestId The id the frontend function received as first argument.
+         * @param reply The result for the backend.
+         */
+        template <typename T>
+        static void replyToBackend(std::uint32_t requestId, T&& reply)
+        {
+            call("Nui::reply", requestId, std::forward<T>(reply));
+        }
+
         /**
          * @brief Register a permanent function that is callable from the backend.
          *
@@ -345,6 +558,28 @@ namespace Nui
             }
         };
 
+        /**
+         * @brief Registers a typed function declared with NUI_RPC that is callable from the backend.
+         *
+         * @param func The function, has to be callable with the arguments of the schema.
+         */
+        template <RpcSchemaType SchemaT, typename FunctionT>
+        static void registerFunction(FunctionT&& func)
+        {
+            static_assert(
+                std::is_void_v<typename SchemaT::ReturnType>,
+                "Functions called by the backend cannot return a value.");
+            static_assert(
+                isRpcSchemaImplementation<SchemaT, std::decay_t<FunctionT>>,
+                "The function does not match the signature of the rpc schema.");
+            registerFunction(
+                SchemaT::name,
+                [func = std::forward<FunctionT>(func)](Nui::val args) mutable {
+                    callSchemaFunction<typename SchemaT::ArgsTuple>(
+                        func, args, std::make_index_sequence<SchemaT::arity>{});
+                });
+        }
+
         template <typename FunctionT>
         static AutoUnregister autoRegisterFunction(std::string const& name, FunctionT&& func)
         {
@@ -396,5 +631,19 @@ namespace Nui
                         static_cast<int>(checkInterval.count()))
                     .as<int>();
         }
+
+      private:
+        template <typename ArgsTuple, std::size_t... Is, typename... ArgsT>
+        static void callSchema(std::string name, std::index_sequence<Is...>, ArgsT&&... args)
+        {
+            getRemoteCallable(std::move(name))(
+                Detail::toRpcVal<std::tuple_element_t<Is, ArgsTuple>>(std::forward<ArgsT>(args))...);
+        }
+
+        template <typename ArgsTuple, typename FunctionT, std::size_t... Is>
+        static void callSchemaFunction(FunctionT& func, Nui::val const& args, std::index_sequence<Is...>)
+        {
+            func(Detail::fromRpcVal<std::tuple_element_t<Is, ArgsTuple>>(args[Is])...);
+        }
     };
 }
\ No newline at end of file
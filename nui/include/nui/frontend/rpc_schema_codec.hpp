@@ -0,0 +1,124 @@
+#pragma once
+
+#include <nui/frontend/utility/val_conversion.hpp>
+#include <nui/frontend/val.hpp>
+
+#include <boost/describe.hpp>
+#include <boost/mp11/algorithm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Nui::Detail
+{
+    template <typename T>
+    struct IsRpcOptional : std::false_type
+    {};
+    template <typename T>
+    struct IsRpcOptional<std::optional<T>> : std::true_type
+    {};
+
+    /// Vectors that may contain described structs are converted element wise, vectors of numbers as a whole.
+    template <typename T>
+    struct IsRpcElementwiseVector : std::false_type
+    {};
+    template <typename T, typename AllocatorT>
+    struct IsRpcElementwiseVector<std::vector<T, AllocatorT>> : std::bool_constant<!std::is_arithmetic_v<T>>
+    {};
+
+    template <typename T>
+    using RpcDescribedMembers =
+        boost::describe::describe_members<T, boost::describe::mod_any_access | boost::describe::mod_inherited>;
+
+    /**
+     * @brief Converts an argument of a typed rpc call. Described structs become arrays of their members, everything
+     * else is converted with convertToVal.
+     */
+    template <typename T>
+    Nui::val toRpcVal(T const& value)
+    {
+        using Decayed = std::decay_t<T>;
+        if constexpr (IsRpcOptional<Decayed>::value)
+        {
+            if (!value)
+                return Nui::val::null();
+            return toRpcVal(*value);
+        }
+        else if constexpr (IsRpcElementwiseVector<Decayed>::value)
+        {
+            Nui::val result = Nui::val::array();
+            for (auto const& element : value)
+                result.call<void>("push", toRpcVal(element));
+            return result;
+        }
+        else if constexpr (boost::describe::has_describe_members<Decayed>::value && !std::is_enum_v<Decayed>)
+        {
+            Nui::val result = Nui::val::array();
+            boost::mp11::mp_for_each<RpcDescribedMembers<Decayed>>([&](auto member) {
+                result.call<void>("push", toRpcVal(value.*member.pointer));
+            });
+            return result;
+        }
+        else if constexpr (std::is_enum_v<Decayed>)
+        {
+            return convertToVal(static_cast<std::underlying_type_t<Decayed>>(value));
+        }
+        else
+        {
+            return convertToVal(value);
+        }
+    }
+
+    /**
+     * @brief Reads a value of a typed rpc call, the inverse of toRpcVal.
+     */
+    template <typename T>
+    T fromRpcVal(Nui::val const& val)
+    {
+        using Decayed = std::decay_t<T>;
+        if constexpr (IsRpcOptional<Decayed>::value)
+        {
+            if (val.isNull() || val.isUndefined())
+                return std::nullopt;
+            return fromRpcVal<typename Decayed::value_type>(val);
+        }
+        else if constexpr (IsRpcElementwiseVector<Decayed>::value)
+        {
+            Decayed result;
+            const auto length = val["length"].template as<std::size_t>();
+            result.reserve(length);
+            for (std::size_t i = 0; i < length; ++i)
+                result.push_back(fromRpcVal<typename Decayed::value_type>(val[i]));
+            return result;
+        }
+        else if constexpr (boost::describe::has_describe_members<Decayed>::value && !std::is_enum_v<Decayed>)
+        {
+            Decayed result{};
+            std::size_t index = 0;
+            boost::mp11::mp_for_each<RpcDescribedMembers<Decayed>>([&](auto member) {
+                using MemberType = std::remove_cvref_t<decltype(result.*member.pointer)>;
+                result.*member.pointer = fromRpcVal<MemberType>(val[index++]);
+            });
+            return result;
+        }
+        else if constexpr (std::is_enum_v<Decayed>)
+        {
+            std::underlying_type_t<Decayed> underlying{};
+            convertFromVal(val, underlying);
+            return static_cast<Decayed>(underlying);
+        }
+        else if constexpr (std::is_same_v<Decayed, Nui::val>)
+        {
+            return val;
+        }
+        else
+        {
+            Decayed result{};
+            convertFromVal(val, result);
+            return result;
+        }
+    }
+}
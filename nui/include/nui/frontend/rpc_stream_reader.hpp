@@ -0,0 +1,190 @@
+#pragma once
+
+#include <nui/frontend/rpc_client.hpp>
+#include <nui/frontend/api/console.hpp>
+#include <nui/frontend/utility/functions.hpp>
+#include <nui/frontend/val.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief The consuming end of a stream produced by a function that was registered with RpcHub::registerStream.
+     * The backend may only send as many chunks as credit was granted, so memory stays bounded while large results
+     * stream in. Streams are registered in the stream table that the backend installs into the view, which is shared
+     * with the streams of rpc.ts.
+     *
+     * @code{.cpp}
+     * auto reader = RpcStreamReader::open(
+     *     "scanDirectory",
+     *     {.credit = 32},
+     *     [&files](std::string const& path) {
+     *         files.value().push_back(path);
+     *     },
+     *     [](std::optional<std::string> const& error) {
+     *         // done
+     *     },
+     *     "/home");
+     * @endcode
+     */
+    class RpcStreamReader
+    {
+      public:
+        struct Options
+        {
+            /// Amount of chunks the backend may send ahead of processing.
+            std::uint32_t credit{16};
+            /// Grant credit again when the chunk handler returned. Otherwise call grant when a chunk was processed,
+            /// e.g. after asynchronous work.
+            bool autoGrant{true};
+        };
+
+        RpcStreamReader()
+            : id_{0}
+        {}
+        explicit RpcStreamReader(std::uint32_t id)
+            : id_{id}
+        {}
+
+        /**
+         * @brief Opens a stream by calling a backend stream function.
+         *
+         * @param name Name of the backend function.
+         * @param options Credit of the stream.
+         * @param onChunk Called for every chunk, the chunk is converted to the parameter type.
+         * @param onEnd Called when the backend closed the stream, with the error if it failed. Not called on cancel.
+         * @param args Arguments passed to the backend function after the stream.
+         * @return RpcStreamReader A handle of the stream, invalid if the function does not exist.
+         */
+        template <typename FunctionT, typename... ArgsT>
+        static RpcStreamReader open(
+            std::string const& name,
+            Options const& options,
+            FunctionT&& onChunk,
+            std::function<void(std::optional<std::string> const&)> onEnd,
+            ArgsT&&... args)
+        {
+            using namespace std::string_literals;
+            if (!RpcClient::RemoteCallable{name})
+            {
+                WebApi::Console::error("Remote stream with name '"s + name + "' is undefined");
+                return RpcStreamReader{};
+            }
+
+            auto stream = std::make_shared<Stream>(Stream{
+                .id = 0,
+                .onChunk = Detail::FunctionWrapper<FunctionT>::wrapFunction(std::forward<FunctionT>(onChunk)),
+                .onEnd = std::move(onEnd),
+                .options = options,
+                .processed = 0,
+            });
+            stream->id = Nui::val::global("nui_rpc")
+                             .call<Nui::val>(
+                                 "openStream",
+                                 Nui::bind(
+                                     [stream](Nui::val chunk) {
+                                         receiveChunk(*stream, chunk);
+                                     },
+                                     std::placeholders::_1),
+                                 Nui::bind(
+                                     [stream](Nui::val error) {
+                                         receiveEnd(*stream, error);
+                                     },
+                                     std::placeholders::_1))
+                             .as<std::uint32_t>();
+            RpcClient::call(name, stream->id, options.credit, std::forward<ArgsT>(args)...);
+            return RpcStreamReader{stream->id};
+        }
+
+        std::uint32_t id() const
+        {
+            return id_;
+        }
+
+        /**
+         * @brief Returns true until the stream ended or was cancelled.
+         */
+        bool isOpen() const
+        {
+            return id_ != 0 && Nui::val::global("nui_rpc").call<Nui::val>("isStreamOpen", id_).as<bool>();
+        }
+
+        /**
+         * @brief Allows the backend to send more chunks. Only needed when autoGrant is off.
+         */
+        void grant(std::uint32_t credit = 1) const
+        {
+            if (isOpen())
+                RpcClient::call("Nui::streamCredit", id_, credit);
+        }
+
+        /**
+         * @brief Stops the backend from sending more chunks, chunks that are still in flight are dropped.
+         *
+         * @return true if the stream was still open.
+         */
+        bool cancel() const
+        {
+            if (id_ == 0 || !Nui::val::global("nui_rpc").call<Nui::val>("closeStream", id_).as<bool>())
+                return false;
+            RpcClient::call("Nui::streamCancel", id_);
+            return true;
+        }
+
+      private:
+        struct Stream
+        {
+            std::uint32_t id;
+            std::function<void(Nui::val const&)> onChunk;
+            std::function<void(std::optional<std::string> const&)> onEnd;
+            Options options;
+            std::uint32_t processed;
+        };
+
+        static void receiveChunk(Stream& stream, Nui::val const& chunk)
+        {
+            try
+            {
+                stream.onChunk(chunk);
+            }
+            catch (std::exception const& exc)
+            {
+                WebApi::Console::error("Caught exception leaving rpc stream handler: {}", exc.what());
+            }
+            catch (...)
+            {
+                WebApi::Console::error("Caught unknown exception leaving rpc stream handler");
+            }
+
+            // The handler may have cancelled the stream.
+            if (!stream.options.autoGrant || !RpcStreamReader{stream.id}.isOpen())
+                return;
+            // Credit is granted in batches of half the window to not answer every chunk.
+            if (++stream.processed >= std::max(stream.options.credit / 2, std::uint32_t{1}))
+                RpcClient::call("Nui::streamCredit", stream.id, std::exchange(stream.processed, 0));
+        }
+
+        static void receiveEnd(Stream& stream, Nui::val const& error)
+        {
+            // The table entry is already gone, the stream does not receive anything anymore.
+            auto onEnd = std::move(stream.onEnd);
+            if (!onEnd)
+                return;
+            if (error.isNull() || error.isUndefined())
+                onEnd(std::nullopt);
+            else
+                onEnd(error.as<std::string>());
+        }
+
+      private:
+        std::uint32_t id_;
+    };
+}
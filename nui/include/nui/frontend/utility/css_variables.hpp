@@ -0,0 +1,46 @@
+#pragma once
+
+#include <nui/event_system/listen.hpp>
+#include <nui/event_system/observed_value.hpp>
+#include <nui/frontend/dom/childless_element.hpp>
+#include <nui/frontend/val.hpp>
+
+#include <string>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief Binds an observed to the CSS custom property "--name" of a root element. Elements below the root can
+     * reference the value with var(--name) in static styles, so a change of the observed is a single
+     * style.setProperty call that the browser cascades, instead of one event per bound element.
+     * For custom properties on individual elements use "--name"_style instead.
+     *
+     * @code{.cpp}
+     * Observed<std::string> accent{"#3a7bd5"};
+     * auto accentBinding = bindCssVariable(accent, "accent");
+     * div{style = "color: var(--accent)"}()
+     * @endcode
+     *
+     * @param obs The observed to bind, must outlive the returned remover.
+     * @param name The name of the custom property, the "--" prefix is added if missing.
+     * @param root The element that gets the property, document.documentElement by default.
+     * @return ListenRemover Removes the binding on destruction, the property keeps its last value.
+     */
+    template <typename ValueT, typename Tags>
+    [[nodiscard("The returned ListenRemover must be stored to keep the binding alive")]]
+    ListenRemover<Observed<ValueT, Tags>> bindCssVariable(
+        Observed<ValueT, Tags> const& obs,
+        std::string name,
+        Nui::val root = Nui::val::global("document")["documentElement"])
+    {
+        if (!name.starts_with("--"))
+            name.insert(0, "--");
+
+        Dom::ChildlessElement{root}.setStyleProperty(name, obs.value());
+        const auto eventId = listen(obs, [name = std::move(name), root = std::move(root)](ValueT const& value) {
+            Dom::ChildlessElement{root}.setStyleProperty(name, value);
+        });
+        return ListenRemover{eventId, obs};
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <nui/event_system/event_context.hpp>
+
+#include <cstddef>
+
+namespace Nui
+{
+    /**
+     * @brief Removes invalid events from the event context in small slices while the browser is idle
+     * (requestIdleCallback, setTimeout where not available) until the incremental sweep reached the end of the
+     * registry.
+     * Useful after large unmounts, so the cleanup does not stall a single frame.
+     *
+     * @param eventsPerSlice The amount of events checked before the remaining idle time is rechecked.
+     * @param ctx The event context to clean up. Must outlive the cleanup.
+     */
+    void cleanInvalidEventsWhenIdle(std::size_t eventsPerSlice = 256, EventContext& ctx = globalEventContext);
+}
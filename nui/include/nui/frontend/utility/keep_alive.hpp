@@ -0,0 +1,227 @@
+#pragma once
+
+#include <nui/frontend/elements/impl/html_element.hpp>
+#include <nui/frontend/element_renderer.hpp>
+#include <nui/frontend/dom/element.hpp>
+#include <nui/frontend/val.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief Caches rendered views by key, e.g. the pages of a fragment router. Switching to a cached view re-attaches
+     * the existing subtree instead of rebuilding it, inactive views are detached from the DOM but keep their elements
+     * and bindings. Inactive views stay cached until evict or clear removes them, or until more than
+     * Options::capacity views are cached, which evicts the least recently shown ones. The cache owns every view, so it
+     * must live as long as the ui that shows them.
+     *
+     * @tparam KeyT Identifies a view, must be equality comparable.
+     */
+    template <typename KeyT>
+    class KeepAlive
+    {
+      public:
+        struct Options
+        {
+            /// Maximum amount of cached views, the least recently used inactive view is evicted first.
+            std::size_t capacity{8};
+            /// Store scrollTop/scrollLeft of the view root when it is deactivated and restore it on activation.
+            bool restoreScrollPosition{false};
+            /// Called when a cached view becomes active again. Use it to resume what onDeactivate paused.
+            std::function<void(KeyT const&)> onActivate{};
+            /// Called when a view is detached, e.g. to pause listeners or subscriptions of the view.
+            std::function<void(KeyT const&)> onDeactivate{};
+            /// Called before a view is evicted from the cache and destroyed.
+            std::function<void(KeyT const&)> onEvict{};
+        };
+
+        KeepAlive()
+            : KeepAlive{Options{}}
+        {}
+        explicit KeepAlive(Options options)
+            : options_{std::move(options)}
+            , views_{}
+            , active_{views_.end()}
+        {}
+        ~KeepAlive() = default;
+        KeepAlive(KeepAlive const&) = delete;
+        KeepAlive(KeepAlive&&) = delete;
+        KeepAlive& operator=(KeepAlive const&) = delete;
+        KeepAlive& operator=(KeepAlive&&) = delete;
+
+        /**
+         * @brief Returns a renderer that shows the cached view of the key or creates it with the factory. The
+         * previously active view is detached.
+         */
+        ElementRenderer view(KeyT const& key, std::function<ElementRenderer()> factory)
+        {
+            return [this, key, factory = std::move(factory)](
+                       Dom::Element& actualParent, Renderer const& gen) -> std::shared_ptr<Dom::Element> {
+                auto entry = find(key);
+                const bool wasActive = entry != views_.end() && entry == active_;
+                if (!wasActive)
+                    deactivate();
+
+                if (entry == views_.end())
+                {
+                    // Each key gets its own holder element that is cached while the view is inactive, the factory result
+                    // replaces it so that a fragment is detached and re-attached as a single node.
+                    auto element = Dom::Element::makeElement(HtmlElement{"div", &RegularHtmlElementBridge});
+                    element->replaceElement(factory());
+                    views_.push_front(View{.key = key, .element = std::move(element)});
+                    entry = views_.begin();
+                    evictOverCapacity();
+                }
+                else
+                {
+                    views_.splice(views_.begin(), views_, entry);
+                }
+                active_ = entry;
+
+                auto slot = HtmlElement{"keep_alive_slot", &RegularHtmlElementBridge}()(actualParent, gen);
+                slot->slotFor(entry->element);
+                if (!wasActive)
+                {
+                    if (options_.restoreScrollPosition && entry->scrollPosition)
+                    {
+                        entry->element->val().set("scrollTop", entry->scrollPosition->first);
+                        entry->element->val().set("scrollLeft", entry->scrollPosition->second);
+                    }
+                    if (options_.onActivate)
+                        options_.onActivate(key);
+                }
+                return slot;
+            };
+        }
+
+        /**
+         * @brief Detaches the active view from the DOM, e.g. when navigating to a view that is not cached.
+         */
+        void deactivate()
+        {
+            if (active_ == views_.end())
+                return;
+
+            auto& view = *active_;
+            active_ = views_.end();
+
+            Nui::val node = view.element->val();
+            if (options_.restoreScrollPosition)
+                view.scrollPosition = {node["scrollTop"].as<double>(), node["scrollLeft"].as<double>()};
+
+            Nui::val parent = node["parentNode"];
+            if (!parent.isUndefined() && !parent.isNull())
+                parent.call<void>("removeChild", node);
+
+            if (options_.onDeactivate)
+                options_.onDeactivate(view.key);
+        }
+
+        /// Removes the view of the key from the cache and destroys it, if it is not active.
+        void evict(KeyT const& key)
+        {
+            auto entry = find(key);
+            if (entry != views_.end() && entry != active_)
+                erase(entry);
+        }
+
+        /// Removes all inactive views from the cache.
+        void clear()
+        {
+            for (auto iter = views_.begin(); iter != views_.end();)
+            {
+                if (iter == active_)
+                    ++iter;
+                else
+                    iter = erase(iter);
+            }
+        }
+
+        bool contains(KeyT const& key) const
+        {
+            return find(key) != views_.end();
+        }
+
+        std::size_t size() const
+        {
+            return views_.size();
+        }
+
+      private:
+        struct View
+        {
+            KeyT key;
+            std::shared_ptr<Dom::Element> element;
+            std::optional<std::pair<double, double>> scrollPosition{};
+        };
+        using ViewList = std::list<View>;
+
+        typename ViewList::iterator find(KeyT const& key)
+        {
+            return std::find_if(views_.begin(), views_.end(), [&key](View const& view) {
+                return view.key == key;
+            });
+        }
+        typename ViewList::const_iterator find(KeyT const& key) const
+        {
+            return std::find_if(views_.begin(), views_.end(), [&key](View const& view) {
+                return view.key == key;
+            });
+        }
+
+        typename ViewList::iterator erase(typename ViewList::iterator entry)
+        {
+            if (options_.onEvict)
+                options_.onEvict(entry->key);
+            return views_.erase(entry);
+        }
+
+        void evictOverCapacity()
+        {
+            while (views_.size() > options_.capacity && views_.size() > 1)
+            {
+                // The front is the view that is being activated, it is never evicted.
+                auto last = std::prev(views_.end());
+                if (last == active_)
+                    break;
+                erase(last);
+            }
+        }
+
+      private:
+        Options options_;
+        ViewList views_;
+        typename ViewList::iterator active_;
+    };
+
+    /**
+     * @brief Renders the view of the key from the cache, or creates and caches it. Meant to be used within
+     * observe(route) blocks, so that navigating back to a view re-attaches it instead of rebuilding it.
+     *
+     * @code{.cpp}
+     * KeepAlive<std::string> pages{{.capacity = 4, .restoreScrollPosition = true}};
+     * // ...
+     * div{}(observe(route), [&]() -> ElementRenderer {
+     *     return keepAlive(pages, route.value(), [&]{ return pageFor(route.value()); });
+     * })
+     * @endcode
+     *
+     * @param cache A cache held by the caller. Must not be destroyed before the associated ui.
+     * @param key The key of the view.
+     * @param factory Creates the renderer of the view, only called when the view is not cached.
+     * @return ElementRenderer
+     */
+    template <typename KeyT>
+    ElementRenderer keepAlive(KeepAlive<KeyT>& cache, KeyT const& key, std::function<ElementRenderer()> factory)
+    {
+        return cache.view(key, std::move(factory));
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <nui/frontend/api/intersection_observer.hpp>
+#include <nui/frontend/element_renderer.hpp>
+#include <nui/frontend/dom/element.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Nui
+{
+    /**
+     * @brief Handle of a lazily rendered subtree. It owns the IntersectionObserver that decides when the subtree is
+     * materialized and has to outlive the associated ui, like StableElement.
+     */
+    class LazyElement
+    {
+      public:
+        struct Options
+        {
+            /// How far outside of the viewport the placeholder counts as near, see IntersectionObserver rootMargin.
+            std::string rootMargin{"200px"};
+            /// Replace the subtree with the placeholder again when it leaves the (margin extended) viewport.
+            bool dematerializeWhenHidden{false};
+            /// Rendered in place of the subtree, an empty div if not set. Give it a size to keep the layout stable.
+            std::optional<ElementRenderer> placeholder{};
+        };
+
+        LazyElement();
+        explicit LazyElement(Options options);
+        ~LazyElement() = default;
+        LazyElement(LazyElement const&) = delete;
+        LazyElement(LazyElement&&) = delete;
+        LazyElement& operator=(LazyElement const&) = delete;
+        LazyElement& operator=(LazyElement&&) = delete;
+
+        /// Returns true when the subtree is currently rendered instead of the placeholder.
+        bool materialized() const;
+
+        /// Renders the subtree now, regardless of its visibility.
+        void materialize();
+
+        /// Replaces the subtree with the placeholder again. It is materialized once it comes near the viewport.
+        void dematerialize();
+
+        friend ElementRenderer lazy(LazyElement& lazyElement, ElementRenderer const& encapsulatedRenderer);
+
+      private:
+        void watch(std::shared_ptr<Dom::Element> const& element);
+        void onIntersection(std::vector<WebApi::IntersectionObserverEntry> const& entries);
+        ElementRenderer placeholder() const;
+
+      private:
+        Options options_;
+        std::optional<WebApi::IntersectionObserver> observer_;
+        std::weak_ptr<Dom::Element> element_;
+        std::optional<ElementRenderer> renderer_;
+        bool materialized_;
+    };
+
+    /**
+     * @brief Renders a placeholder and materializes the encapsulated renderer only once the placeholder comes near
+     * the viewport. Initial render cost is then proportional to what is visible.
+     *
+     * @code{.cpp}
+     * LazyElement lazyComments{{.rootMargin = "400px", .placeholder = div{style = "height: 600px"}()}};
+     * // ...
+     * lazy(lazyComments, section{}(comments()))
+     * @endcode
+     *
+     * @param lazyElement A lazy element handle held by the caller. Must not be destroyed before the associated ui.
+     * @param encapsulatedRenderer The renderer that is materialized when visible.
+     * @return ElementRenderer A renderer that renders the placeholder.
+     */
+    ElementRenderer lazy(LazyElement& lazyElement, ElementRenderer const& encapsulatedRenderer);
+}
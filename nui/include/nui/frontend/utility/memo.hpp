@@ -0,0 +1,121 @@
+#pragma once
+
+#include <nui/frontend/elements/impl/html_element.hpp>
+#include <nui/frontend/element_renderer.hpp>
+#include <nui/frontend/dom/element.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Nui
+{
+    /**
+     * @brief Handle of a memoized subtree. It owns the subtree rendered last and the dependency values it was rendered
+     * with. A render with dependencies the comparator considers equal moves that subtree into place, any other render
+     * replaces it. Destroying the handle destroys the subtree, so it must live as long as the ui that shows it.
+     *
+     * @tparam DepsT The types of the dependencies.
+     */
+    template <typename... DepsT>
+    class MemoElement
+    {
+      public:
+        using DependencyTuple = std::tuple<DepsT...>;
+        using Comparator = std::function<bool(DependencyTuple const&, DependencyTuple const&)>;
+
+        MemoElement()
+            : MemoElement{std::equal_to<DependencyTuple>{}}
+        {}
+
+        /**
+         * @param equal Returns true if the previous and current dependencies are equivalent.
+         */
+        explicit MemoElement(Comparator equal)
+            : equal_{std::move(equal)}
+            , dependencies_{}
+            , element_{}
+        {}
+
+        /// Forgets the dependencies, so that the subtree is rebuilt on the next render.
+        void reset()
+        {
+            dependencies_.reset();
+        }
+
+        /// Destroys the memoized subtree directly, which will make it also disappear from the page.
+        void destroy()
+        {
+            dependencies_.reset();
+            element_.reset();
+        }
+
+        /**
+         * @brief Returns a renderer that reuses the previously rendered subtree if the dependencies are equal to
+         * the ones of the previous render and only calls the factory otherwise.
+         */
+        ElementRenderer render(DepsT const&... deps, std::function<ElementRenderer()> factory)
+        {
+            return [this, dependencies = DependencyTuple{deps...}, factory = std::move(factory)](
+                       Dom::Element& actualParent, Renderer const& gen) -> std::shared_ptr<Dom::Element> {
+                if (!element_ || !dependencies_ || !equal_(*dependencies_, dependencies))
+                {
+                    dependencies_ = dependencies;
+                    // The factory result replaces a holder element, so that a fragment stays a single node the slot can
+                    // move. The previous holder and all bindings in it are dropped here.
+                    element_ = Dom::Element::makeElement(HtmlElement{"div", &RegularHtmlElementBridge});
+                    element_->replaceElement(factory());
+                }
+                // The slot moves the kept subtree to the position of this render.
+                return HtmlElement{"memo_slot", &RegularHtmlElementBridge}()(actualParent, gen)->slotFor(element_);
+            };
+        }
+
+      private:
+        Comparator equal_;
+        std::optional<DependencyTuple> dependencies_;
+        std::shared_ptr<Dom::Element> element_;
+    };
+
+    /**
+     * @brief Memoizes a subtree on the given dependencies. When an enclosing observe block or switch_ re-renders with
+     * equal dependencies, the existing subtree and its bindings are kept and only moved into place.
+     *
+     * @code{.cpp}
+     * MemoElement<int, std::string> panelMemo;
+     * // ...
+     * div{}(observe(tick, user), [&]() -> ElementRenderer {
+     *     return memo(panelMemo, user->id, user->name, [&]{ return expensivePanel(*user); });
+     * })
+     * @endcode
+     *
+     * @param memoElement A memo handle held by the caller. Must not be destroyed before the associated ui.
+     * @param depsAndRenderer The dependency values, compared with the comparator of the memoElement, followed by either
+     * an ElementRenderer or a factory returning one. The factory is only called when the dependencies changed.
+     * @return ElementRenderer
+     */
+    template <typename... DepsT, typename... ArgsT>
+    requires(sizeof...(ArgsT) == sizeof...(DepsT) + 1)
+    ElementRenderer memo(MemoElement<DepsT...>& memoElement, ArgsT&&... depsAndRenderer)
+    {
+        auto arguments = std::forward_as_tuple(std::forward<ArgsT>(depsAndRenderer)...);
+        auto&& renderer = std::get<sizeof...(DepsT)>(arguments);
+
+        std::function<ElementRenderer()> factory;
+        if constexpr (std::is_invocable_r_v<ElementRenderer, decltype(renderer)>)
+            factory = std::forward<decltype(renderer)>(renderer);
+        else
+        {
+            factory = [renderer = ElementRenderer{std::forward<decltype(renderer)>(renderer)}]() {
+                return renderer;
+            };
+        }
+
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return memoElement.render(std::get<Is>(arguments)..., std::move(factory));
+        }(std::index_sequence_for<DepsT...>{});
+    }
+}
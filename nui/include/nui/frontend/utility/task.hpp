@@ -0,0 +1,193 @@
+#pragma once
+
+#include <nui/frontend/api/console.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Nui
+{
+    template <typename T = void>
+    class Task;
+
+    namespace Detail
+    {
+        template <typename T>
+        struct TaskPromiseBase
+        {
+            std::coroutine_handle<> continuation{};
+            std::exception_ptr exception{};
+            bool detached{false};
+
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+                template <typename PromiseT>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+                {
+                    auto& promise = handle.promise();
+                    if (promise.continuation)
+                        return promise.continuation;
+                    if (promise.detached)
+                    {
+                        // Nobody can observe the result anymore, so the frame cleans up after itself.
+                        if (promise.exception)
+                            logDetachedException(promise.exception);
+                        handle.destroy();
+                    }
+                    return std::noop_coroutine();
+                }
+                void await_resume() noexcept
+                {}
+            };
+
+            FinalAwaiter final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception()
+            {
+                exception = std::current_exception();
+            }
+
+            static void logDetachedException(std::exception_ptr const& exception) noexcept
+            {
+                try
+                {
+                    std::rethrow_exception(exception);
+                }
+                catch (std::exception const& exc)
+                {
+                    WebApi::Console::error("Unhandled exception in detached task:", exc.what());
+                }
+                catch (...)
+                {
+                    WebApi::Console::error("Unhandled unknown exception in detached task");
+                }
+            }
+        };
+
+        template <typename T>
+        struct TaskPromise : public TaskPromiseBase<T>
+        {
+            std::optional<T> value{};
+
+            Task<T> get_return_object();
+
+            template <typename U>
+            void return_value(U&& result)
+            {
+                value.emplace(std::forward<U>(result));
+            }
+        };
+
+        template <>
+        struct TaskPromise<void> : public TaskPromiseBase<void>
+        {
+            Task<void> get_return_object();
+
+            void return_void()
+            {}
+        };
+    }
+
+    /**
+     * @brief A coroutine that starts immediately, e.g. from an event handler, and can be awaited by other tasks.
+     * Dropping the task without awaiting it lets it run to completion on its own.
+     *
+     * @code{.cpp}
+     * Nui::Task<> loadProfile()
+     * {
+     *     auto [user, settings] = co_await whenAll(rpcRequest<User>("getUser"), rpcRequest<Settings>("getSettings"));
+     *     // ...
+     * }
+     * @endcode
+     *
+     * @tparam T The result of the coroutine.
+     */
+    template <typename T>
+    class Task
+    {
+      public:
+        using promise_type = Detail::TaskPromise<T>;
+
+        explicit Task(std::coroutine_handle<promise_type> handle)
+            : handle_{handle}
+        {}
+        ~Task()
+        {
+            if (!handle_)
+                return;
+            if (handle_.done())
+                handle_.destroy();
+            else
+                handle_.promise().detached = true;
+        }
+        Task(Task const&) = delete;
+        Task(Task&& other) noexcept
+            : handle_{std::exchange(other.handle_, nullptr)}
+        {}
+        Task& operator=(Task const&) = delete;
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Task discarded{std::move(*this)};
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        /// Returns true if the coroutine ran to completion.
+        bool done() const
+        {
+            return !handle_ || handle_.done();
+        }
+
+        bool await_ready() const noexcept
+        {
+            return done();
+        }
+        void await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            handle_.promise().continuation = continuation;
+        }
+        T await_resume()
+        {
+            auto& promise = handle_.promise();
+            if (promise.exception)
+                std::rethrow_exception(promise.exception);
+            if constexpr (!std::is_void_v<T>)
+                return std::move(*promise.value);
+        }
+
+      private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    namespace Detail
+    {
+        template <typename T>
+        Task<T> TaskPromise<T>::get_return_object()
+        {
+            return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object()
+        {
+            return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace Nui
+{
+    /**
+     * @brief Error of an rpc request that timed out, was cancelled or could not be made. The frontend throws it from
+     * co_await of a request, the backend sets it on the future of RpcHub::request.
+     */
+    class RpcRequestError : public std::runtime_error
+    {
+      public:
+        using std::runtime_error::runtime_error;
+    };
+}
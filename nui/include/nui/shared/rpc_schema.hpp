@@ -0,0 +1,69 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace Nui
+{
+    /**
+     * @brief Signature of a typed rpc function, see NUI_RPC.
+     *
+     * Arguments and results of typed calls use a positional encoding: described structs are sent as arrays of their
+     * members in declaration order instead of objects, so both ends have to be built from the same declaration.
+     */
+    template <typename SignatureT>
+    struct RpcSchema;
+
+    template <typename ReturnT, typename... ArgsT>
+    struct RpcSchema<ReturnT(ArgsT...)>
+    {
+        using ReturnType = ReturnT;
+        using ArgsTuple = std::tuple<std::decay_t<ArgsT>...>;
+        using FunctionPointer = ReturnT (*)(ArgsT...);
+        constexpr static std::size_t arity = sizeof...(ArgsT);
+    };
+
+    template <typename T>
+    concept RpcSchemaType = requires {
+        { T::name } -> std::convertible_to<char const*>;
+        typename T::ReturnType;
+        typename T::ArgsTuple;
+        typename T::FunctionPointer;
+    };
+
+    /// Arguments that can be passed to the typed rpc function.
+    template <typename SchemaT, typename... ArgsT>
+    concept RpcSchemaArguments = std::is_invocable_v<typename SchemaT::FunctionPointer, ArgsT...>;
+
+    /// A function that can implement the typed rpc function.
+    template <typename SchemaT, typename FunctionT, typename ArgsTuple = typename SchemaT::ArgsTuple>
+    constexpr static bool isRpcSchemaImplementation = false;
+
+    template <typename SchemaT, typename FunctionT, typename... ArgsT>
+    constexpr static bool isRpcSchemaImplementation<SchemaT, FunctionT, std::tuple<ArgsT...>> =
+        std::is_invocable_r_v<typename SchemaT::ReturnType, FunctionT&, ArgsT...>;
+}
+
+/**
+ * @brief Declares a typed rpc function that is shared between frontend and backend.
+ *
+ * @code{.cpp}
+ * // shared header
+ * NUI_RPC(readDirectory, std::vector<FileEntry>(std::string const& path, bool recursive));
+ *
+ * // backend
+ * hub.registerFunction<readDirectory>([](std::string const& path, bool recursive) { ... });
+ *
+ * // frontend
+ * auto entries = co_await rpcRequest<readDirectory>("/home", false);
+ * @endcode
+ *
+ * Passing arguments or registering functions that do not match the signature does not compile.
+ */
+#define NUI_RPC(Name, ...) \
+    struct Name : public ::Nui::RpcSchema<__VA_ARGS__> \
+    { \
+        constexpr static char const* name = #Name; \
+    }
@@ -3,17 +3,563 @@
 #include <nui/event_system/listen.hpp>
 #include <nui/event_system/tags.hpp>
 #include <nui/rpc.hpp>
+#include <nui/utility/scope_exit.hpp>
 
 #ifndef NUI_FRONTEND
 #    include <nlohmann/json.hpp>
+
+#    include <boost/asio/steady_timer.hpp>
 #else
 #    include <nui/frontend/utility/val_conversion.hpp>
+#    include <nui/frontend/val.hpp>
 #endif
 
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace Nui
 {
+    /**
+     * @brief Limits how often a Synchronizer sends changes to the other side. Changes that happen while a message is
+     * held back are conflated, only the latest state is sent once the wait is over.
+     *
+     * Each side configures the direction it sends in.
+     */
+    struct SynchronizerOptions
+    {
+        /// Minimum time between two messages. Zero sends every change immediately.
+        std::chrono::milliseconds minimumInterval{0};
+        /// Send the first change after a quiet period immediately. Otherwise every change waits for the interval to
+        /// pass, so bursts become a single message.
+        bool leadingEdge{true};
+        /// Send at most once per animation frame, takes precedence over minimumInterval. The backend has no frames and
+        /// waits for one frame at 60 Hz instead.
+        bool perAnimationFrame{false};
+    };
+
+    namespace Detail
+    {
+        /// Containers that are synchronized by sending the changed index ranges instead of the whole value.
+        template <typename ContainerT>
+        struct IsDeltaSynchronizedContainer : std::false_type
+        {};
+        template <typename... Parameters>
+        struct IsDeltaSynchronizedContainer<std::vector<Parameters...>> : std::true_type
+        {};
+        template <typename... Parameters>
+        struct IsDeltaSynchronizedContainer<std::deque<Parameters...>> : std::true_type
+        {};
+
+        template <typename ObservedT>
+        concept DeltaSynchronized = IsDeltaSynchronizedContainer<typename ObservedT::observed_type>::value;
+
+        template <typename ValueT>
+        struct SyncDeltaRange
+        {
+            long low;
+            long high;
+            std::vector<ValueT> values;
+        };
+
+        /**
+         * @brief Applies the changed ranges of the other side through the container interface, so that the ranges
+         * are tracked again for the range renderers of this side.
+         *
+         * Insertions are given in their final positions, erasures in the positions before erasing, like they are
+         * tracked by the RangeEventContext.
+         *
+         * @return false if a range does not fit the container, which happens when both sides changed it at the same
+         * time. The remaining ranges are not applied and the container has to be replaced by the whole value.
+         */
+        template <typename ObservedT, typename ValueT>
+        bool applySyncDelta(ObservedT& observed, RangeOperationType type, std::vector<SyncDeltaRange<ValueT>>& ranges)
+        {
+            switch (type)
+            {
+                case RangeOperationType::Insert:
+                {
+                    for (auto& range : ranges)
+                    {
+                        if (range.low < 0 || range.low > static_cast<long>(observed.size()) || range.values.empty())
+                            return false;
+                        observed.insert(
+                            observed.cbegin() + range.low,
+                            std::make_move_iterator(range.values.begin()),
+                            std::make_move_iterator(range.values.end()));
+                    }
+                    return true;
+                }
+                case RangeOperationType::Modify:
+                {
+                    for (auto& range : ranges)
+                    {
+                        if (range.low < 0 ||
+                            range.low + static_cast<long>(range.values.size()) > static_cast<long>(observed.size()))
+                            return false;
+                        for (long i = 0; i != static_cast<long>(range.values.size()); ++i)
+                        {
+                            observed[static_cast<std::size_t>(range.low + i)] =
+                                std::move(range.values[static_cast<std::size_t>(i)]);
+                        }
+                    }
+                    return true;
+                }
+                case RangeOperationType::Erase:
+                {
+                    // Erasures are replayed from the end, so that the positions of the ranges stay valid.
+                    for (auto range = ranges.rbegin(); range != ranges.rend(); ++range)
+                    {
+                        if (range->low < 0 || range->high < range->low ||
+                            range->high >= static_cast<long>(observed.size()))
+                            return false;
+                        observed.erase(observed.cbegin() + range->low, observed.cbegin() + range->high + 1);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+
+#ifdef NUI_FRONTEND
+        /**
+         * @brief Creates the message for a changed observed value. Containers send only their changed ranges when
+         * the context tracked them, otherwise the whole value is sent.
+         */
+        template <typename ContainerT>
+        Nui::val makeSyncPayload(RangeEventContext const* context, ContainerT const& value)
+        {
+            if constexpr (!IsDeltaSynchronizedContainer<ContainerT>::value)
+                return convertToVal(value);
+            else
+            {
+                if (context == nullptr || context->isFullRangeUpdate() || context->isInDefaultState())
+                    return convertToVal(value);
+
+                const auto type = context->operationType();
+                Nui::val ranges = Nui::val::array();
+                for (auto const& interval : *context)
+                {
+                    Nui::val range = Nui::val::object();
+                    range.set("low", Nui::val{interval.low()});
+                    range.set("high", Nui::val{interval.high()});
+                    if (type != RangeOperationType::Erase)
+                    {
+                        Nui::val values = Nui::val::array();
+                        for (auto i = interval.low(); i <= interval.high(); ++i)
+                            values.call<void>("push", convertToVal(value[static_cast<std::size_t>(i)]));
+                        range.set("values", values);
+                    }
+                    ranges.call<void>("push", range);
+                }
+                Nui::val payload = Nui::val::object();
+                payload.set("_rangeOperation", Nui::val{static_cast<int>(type)});
+                payload.set("ranges", ranges);
+                return payload;
+            }
+        }
+
+        /// Asks the other side for its whole value, after a delta of it could not be applied.
+        inline Nui::val makeSyncResyncRequest()
+        {
+            Nui::val payload = Nui::val::object();
+            payload.set("_resync", Nui::val{true});
+            return payload;
+        }
+
+        inline bool isSyncResyncRequest(Nui::val const& payload)
+        {
+            return payload.typeOf().as<std::string>() == "object" && !payload.isNull() && !payload.isArray() &&
+                payload.hasOwnProperty("_resync");
+        }
+
+        /**
+         * @brief Applies a message of the other side.
+         *
+         * @return false if a delta did not fit this side, see applySyncDelta.
+         */
+        template <typename ObservedT>
+        bool receiveSyncPayload(ObservedT& observed, Nui::val const& payload)
+        {
+            if constexpr (DeltaSynchronized<ObservedT>)
+            {
+                if (!payload.isArray())
+                {
+                    using ValueType = typename ObservedT::value_type;
+                    const auto type = static_cast<RangeOperationType>(payload["_rangeOperation"].as<int>());
+                    const auto ranges = payload["ranges"];
+                    const auto length = ranges["length"].as<std::size_t>();
+
+                    std::vector<SyncDeltaRange<ValueType>> delta(length);
+                    for (std::size_t i = 0; i != length; ++i)
+                    {
+                        const auto range = ranges[i];
+                        delta[i].low = range["low"].as<long>();
+                        delta[i].high = range["high"].as<long>();
+                        if (type != RangeOperationType::Erase)
+                            convertFromVal(range["values"], delta[i].values);
+                    }
+                    const bool applied = applySyncDelta(observed, type, delta);
+                    observed.eventContext().executeActiveEventsImmediately();
+                    return applied;
+                }
+            }
+            convertFromVal(payload, observed.modifyNow().value());
+            return true;
+        }
+#else
+        /**
+         * @brief Creates the message for a changed observed value. Containers send only their changed ranges when
+         * the context tracked them, otherwise the whole value is sent.
+         */
+        template <typename ContainerT>
+        nlohmann::json makeSyncPayload(RangeEventContext const* context, ContainerT const& value)
+        {
+            if constexpr (!IsDeltaSynchronizedContainer<ContainerT>::value)
+                return nlohmann::json(value);
+            else
+            {
+                if (context == nullptr || context->isFullRangeUpdate() || context->isInDefaultState())
+                    return nlohmann::json(value);
+
+                const auto type = context->operationType();
+                auto ranges = nlohmann::json::array();
+                for (auto const& interval : *context)
+                {
+                    auto range = nlohmann::json{{"low", interval.low()}, {"high", interval.high()}};
+                    if (type != RangeOperationType::Erase)
+                    {
+                        auto& values = range["values"] = nlohmann::json::array();
+                        for (auto i = interval.low(); i <= interval.high(); ++i)
+                            values.push_back(value[static_cast<std::size_t>(i)]);
+                    }
+                    ranges.push_back(std::move(range));
+                }
+                return nlohmann::json{{"_rangeOperation", static_cast<int>(type)}, {"ranges", std::move(ranges)}};
+            }
+        }
+
+        /// Asks the other side for its whole value, after a delta of it could not be applied.
+        inline nlohmann::json makeSyncResyncRequest()
+        {
+            return nlohmann::json{{"_resync", true}};
+        }
+
+        inline bool isSyncResyncRequest(nlohmann::json const& payload)
+        {
+            return payload.is_object() && payload.contains("_resync");
+        }
+
+        /**
+         * @brief Applies a message of the other side.
+         *
+         * @return false if a delta did not fit this side, see applySyncDelta.
+         */
+        template <typename ObservedT>
+        bool receiveSyncPayload(ObservedT& observed, nlohmann::json const& payload)
+        {
+            if constexpr (DeltaSynchronized<ObservedT>)
+            {
+                if (payload.is_object())
+                {
+                    using ValueType = typename ObservedT::value_type;
+                    const auto type = static_cast<RangeOperationType>(payload.at("_rangeOperation").get<int>());
+
+                    std::vector<SyncDeltaRange<ValueType>> delta;
+                    delta.reserve(payload.at("ranges").size());
+                    for (auto const& range : payload.at("ranges"))
+                    {
+                        delta.push_back(
+                            {.low = range.at("low").get<long>(),
+                             .high = range.at("high").get<long>(),
+                             .values = range.contains("values") ? range["values"].get<std::vector<ValueType>>()
+                                                                : std::vector<ValueType>{}});
+                    }
+                    const bool applied = applySyncDelta(observed, type, delta);
+                    observed.eventContext().sync();
+                    return applied;
+                }
+            }
+            observed = payload.template get<typename ObservedT::observed_type>();
+            observed.eventContext().sync();
+            return true;
+        }
+#endif
+
+        /**
+         * @brief Listens to changes of a synchronized observed and passes the message for the other side to send.
+         * Containers track their changed ranges in an own context. It has to be read before the ranges are reset after
+         * the event processing, so containers are not listened to with the delayed smartListen.
+         */
+        template <typename ValueT, typename Tags, typename SendT>
+        ListenRemover<Observed<ValueT, Tags>> listenForSync(Observed<ValueT, Tags> const& observed, SendT send)
+        {
+            if constexpr (DeltaSynchronized<Observed<ValueT, Tags>>)
+            {
+                auto context = std::make_shared<RangeEventContext>();
+                observed.attachReaderContext(context);
+                return ListenRemover<Observed<ValueT, Tags>>{
+                    listen(
+                        observed,
+                        [context, send = std::move(send)](auto const& value) mutable {
+                            send(makeSyncPayload(context.get(), value));
+                            context->reset();
+                        }),
+                    observed};
+            }
+            else
+            {
+                return smartListen(observed, [send = std::move(send)](auto const& value) mutable {
+                    send(makeSyncPayload(nullptr, value));
+                });
+            }
+        }
+
+        template <typename ValueT, typename Tags, typename SendT>
+        ListenRemover<std::shared_ptr<Observed<ValueT, Tags>>>
+        listenForSync(std::shared_ptr<Observed<ValueT, Tags>> const& observed, SendT send)
+        {
+            if constexpr (DeltaSynchronized<Observed<ValueT, Tags>>)
+            {
+                auto context = std::make_shared<RangeEventContext>();
+                observed->attachReaderContext(context);
+                return ListenRemover<std::shared_ptr<Observed<ValueT, Tags>>>{
+                    listen(
+                        observed,
+                        [context, send = std::move(send)](auto const& value) mutable {
+                            send(makeSyncPayload(context.get(), value));
+                            context->reset();
+                        }),
+                    observed};
+            }
+            else
+            {
+                return smartListen(observed, [send = std::move(send)](auto const& value) mutable {
+                    send(makeSyncPayload(nullptr, value));
+                });
+            }
+        }
+
+        /// Runs the function after the delay or, without one, in the next animation frame.
+        using SyncScheduler = std::function<void(std::optional<std::chrono::milliseconds>, std::function<void()>)>;
+
+#ifdef NUI_FRONTEND
+        inline SyncScheduler makeSyncScheduler()
+        {
+            return [](std::optional<std::chrono::milliseconds> delay, std::function<void()> func) {
+                if (!delay)
+                {
+                    Nui::val::global("requestAnimationFrame")(Nui::bind(
+                        [func = std::move(func)](Nui::val const&) {
+                            func();
+                        },
+                        std::placeholders::_1));
+                }
+                else
+                {
+                    Nui::val::global("globalThis")
+                        .call<Nui::val>(
+                            "setTimeout",
+                            Nui::bind([func = std::move(func)]() {
+                                func();
+                            }),
+                            static_cast<int>(delay->count()));
+                }
+            };
+        }
+#else
+        inline SyncScheduler makeSyncScheduler(Window& window)
+        {
+            return [&window](std::optional<std::chrono::milliseconds> delay, std::function<void()> func) {
+                constexpr std::chrono::milliseconds frameInterval{16};
+                auto timer = std::make_shared<boost::asio::steady_timer>(
+                    window.getExecutor(), delay ? *delay : frameInterval);
+                timer->async_wait([timer, &window, func = std::move(func)](boost::system::error_code const& error) {
+                    if (!error)
+                        window.dispatch(func);
+                });
+            };
+        }
+#endif
+
+        /**
+         * @brief Holds back the messages of a Synchronizer according to its options. A held back message is replaced
+         * by the current value when more changes arrive or the other side changed the value in the meantime, because
+         * changed ranges cannot be merged.
+         */
+        template <typename PayloadT>
+        class SyncSendGate : public std::enable_shared_from_this<SyncSendGate<PayloadT>>
+        {
+          public:
+            SyncSendGate(
+                SynchronizerOptions const& options,
+                SyncScheduler schedule,
+                std::function<PayloadT()> currentValue,
+                std::function<void(PayloadT const&)> send)
+                : options_{options}
+                , schedule_{std::move(schedule)}
+                , currentValue_{std::move(currentValue)}
+                , send_{std::move(send)}
+            {}
+
+            void change(PayloadT payload)
+            {
+                conflated_ = conflated_ || pending_.has_value();
+                pending_ = std::move(payload);
+                if (scheduled_)
+                    return;
+
+                // Nothing sent yet counts as a quiet period, the steady clock may have started less than an interval
+                // ago.
+                const auto elapsed = lastSend_ ? std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                     std::chrono::steady_clock::now() - *lastSend_)
+                                               : options_.minimumInterval;
+                if (options_.perAnimationFrame)
+                {
+                    scheduled_ = true;
+                    schedule_(std::nullopt, flushFunction());
+                }
+                else if (options_.leadingEdge && elapsed >= options_.minimumInterval)
+                {
+                    flush();
+                }
+                else
+                {
+                    scheduled_ = true;
+                    schedule_(
+                        options_.leadingEdge ? options_.minimumInterval - elapsed : options_.minimumInterval,
+                        flushFunction());
+                }
+            }
+
+            /// The other side changed the value. A held back delta refers to positions from before that change, so the
+            /// current value is sent in its place.
+            void otherSideChanged()
+            {
+                conflated_ = conflated_ || pending_.has_value();
+            }
+
+            /// Sends the current value right away, a held back message is dropped because the value includes it.
+            void sendCurrentValue()
+            {
+                pending_.reset();
+                conflated_ = false;
+                send_(currentValue_());
+                lastSend_ = std::chrono::steady_clock::now();
+            }
+
+          private:
+            std::function<void()> flushFunction()
+            {
+                return [weak = this->weak_from_this()]() {
+                    if (auto self = weak.lock(); self)
+                        self->flush();
+                };
+            }
+
+            void flush()
+            {
+                scheduled_ = false;
+                if (!pending_)
+                    return;
+                if (conflated_)
+                    send_(currentValue_());
+                else
+                    send_(*pending_);
+                pending_.reset();
+                conflated_ = false;
+                lastSend_ = std::chrono::steady_clock::now();
+            }
+
+          private:
+            SynchronizerOptions options_;
+            SyncScheduler schedule_;
+            std::function<PayloadT()> currentValue_;
+            std::function<void(PayloadT const&)> send_;
+            std::optional<PayloadT> pending_{};
+            bool conflated_{false};
+            bool scheduled_{false};
+            std::optional<std::chrono::steady_clock::time_point> lastSend_{};
+        };
+
+        /**
+         * @brief Connects a Synchronizer to the other side. Changes of this side are passed through a SyncSendGate
+         * when the options limit the rate. A delta of the other side that does not fit this side, because both sides
+         * changed the container at the same time, is answered with a request for the whole value.
+         */
+        template <typename PayloadT>
+        class SyncLink
+        {
+          public:
+            SyncLink(
+                SynchronizerOptions const& options,
+                SyncScheduler schedule,
+                std::function<PayloadT()> currentValue,
+                std::function<void(PayloadT const&)> send)
+                : currentValue_{std::move(currentValue)}
+                , send_{std::move(send)}
+                , gate_{}
+            {
+                if (options.minimumInterval.count() > 0 || options.perAnimationFrame)
+                {
+                    gate_ =
+                        std::make_shared<SyncSendGate<PayloadT>>(options, std::move(schedule), currentValue_, send_);
+                }
+            }
+
+            /// Sends a change of this side. Changes caused by a message of the other side are not sent back.
+            void change(PayloadT const& payload)
+            {
+                if (receiving_)
+                    return;
+                if (gate_)
+                    gate_->change(payload);
+                else
+                    send_(payload);
+            }
+
+            template <typename ObservedT>
+            void receive(ObservedT& observed, PayloadT const& payload)
+            {
+                if (isSyncResyncRequest(payload))
+                {
+                    if (gate_)
+                        gate_->sendCurrentValue();
+                    else
+                        send_(currentValue_());
+                    return;
+                }
+
+                if (gate_)
+                    gate_->otherSideChanged();
+
+                bool applied = false;
+                {
+                    receiving_ = true;
+                    NUI_ON_SCOPE_EXIT
+                    {
+                        receiving_ = false;
+                    };
+                    applied = receiveSyncPayload(observed, payload);
+                }
+                if (!applied)
+                    send_(makeSyncResyncRequest());
+            }
+
+          private:
+            std::function<PayloadT()> currentValue_;
+            std::function<void(PayloadT const&)> send_;
+            std::shared_ptr<SyncSendGate<PayloadT>> gate_;
+            bool receiving_{false};
+        };
+    }
+
     template <typename ObservedT>
     class SynchronizerBase
     {
@@ -38,57 +584,71 @@ namespace Nui
 #ifdef NUI_FRONTEND
 
       private:
-        explicit Synchronizer(ObservedT& observed, std::shared_ptr<bool> const& eventComesFromRpc)
+        using Link = Detail::SyncLink<Nui::val>;
+
+        explicit Synchronizer(std::shared_ptr<Link> const& link, ObservedT& observed)
             : SynchronizerBase<ObservedT>{
                   RpcClient::autoRegisterFunction(
                       "observed_" + std::string(syncId(observed)),
-                      [&observed, eventComesFromRpc = eventComesFromRpc](Nui::val value) mutable {
-                          {
-                              *eventComesFromRpc = true;
-                              convertFromVal(value, observed.modifyNow().value());
-                          }
-                          *eventComesFromRpc = false;
+                      [&observed, link](Nui::val value) {
+                          link->receive(observed, value);
                       }),
-                  Nui::smartListen(
+                  Detail::listenForSync(
                       observed,
-                      [eventComesFromRpc = eventComesFromRpc](auto const& value) mutable {
-                          if (!*eventComesFromRpc)
-                              RpcClient::call("observed_" + std::string(syncId(ObservedT{})), convertToVal(value));
+                      [link](Nui::val const& payload) {
+                          link->change(payload);
                       }),
               }
         {}
 
       public:
-        explicit Synchronizer(ObservedT& observed)
-            : Synchronizer{observed, std::make_shared<bool>(false)}
+        explicit Synchronizer(ObservedT& observed, SynchronizerOptions const& options = {})
+            : Synchronizer{
+                  std::make_shared<Link>(
+                      options,
+                      Detail::makeSyncScheduler(),
+                      [&observed]() {
+                          return Detail::makeSyncPayload(nullptr, observed.value());
+                      },
+                      [name = "observed_" + std::string(syncId(observed))](Nui::val const& payload) {
+                          RpcClient::call(name, payload);
+                      }),
+                  observed}
         {}
 #else
 
       private:
-        explicit Synchronizer(RpcHub& hub, ObservedT& observed, std::shared_ptr<bool> const& eventComesFromRpc)
+        using Link = Detail::SyncLink<nlohmann::json>;
+
+        explicit Synchronizer(std::shared_ptr<Link> const& link, RpcHub& hub, ObservedT& observed)
             : SynchronizerBase<ObservedT>{
                   hub.autoRegisterFunction(
                       "observed_" + std::string(syncId(observed)),
-                      [&observed, eventComesFromRpc = eventComesFromRpc](nlohmann::json const& value) mutable {
-                          {
-                              *eventComesFromRpc = true;
-                              observed = value.template get<typename ObservedT::observed_type>();
-                              observed.eventContext().sync();
-                          }
-                          *eventComesFromRpc = false;
+                      [&observed, link](nlohmann::json const& value) {
+                          link->receive(observed, value);
                       }),
-                  Nui::smartListen(
+                  Detail::listenForSync(
                       observed,
-                      [&hub, eventComesFromRpc = eventComesFromRpc](auto const& value) mutable {
-                          if (!*eventComesFromRpc)
-                              hub.call("observed_" + std::string(syncId(ObservedT{})), nlohmann::json(value));
+                      [link](nlohmann::json const& payload) {
+                          link->change(payload);
                       }),
               }
         {}
 
       public:
-        explicit Synchronizer(RpcHub& hub, ObservedT& observed)
-            : Synchronizer{hub, observed, std::make_shared<bool>(false)}
+        explicit Synchronizer(RpcHub& hub, ObservedT& observed, SynchronizerOptions const& options = {})
+            : Synchronizer{
+                  std::make_shared<Link>(
+                      options,
+                      Detail::makeSyncScheduler(hub.window()),
+                      [&observed]() {
+                          return Detail::makeSyncPayload(nullptr, observed.value());
+                      },
+                      [&hub, name = "observed_" + std::string(syncId(observed))](nlohmann::json const& payload) {
+                          hub.call(name, payload);
+                      }),
+                  hub,
+                  observed}
         {}
 #endif
     };
@@ -98,74 +658,78 @@ namespace Nui
     class Synchronizer<SharedObservedT> : public SynchronizerBase<SharedObservedT>
     {
       public:
-        using ObservedT = typename SharedObservedT::value_type;
+        using ObservedT = typename SharedObservedT::element_type;
 
 #ifdef NUI_FRONTEND
 
       private:
-        explicit Synchronizer(SharedObservedT const& observed, std::shared_ptr<bool> const& eventComesFromRpc)
+        using Link = Detail::SyncLink<Nui::val>;
+
+        explicit Synchronizer(std::shared_ptr<Link> const& link, SharedObservedT const& observed)
             : SynchronizerBase<SharedObservedT>{
                   RpcClient::autoRegisterFunction(
-                      "observed_" + std::string(syncId(observed)),
-                      [weak = std::weak_ptr{observed}, eventComesFromRpc = eventComesFromRpc](Nui::val value) mutable {
-                          auto observed = weak.lock();
-                          if (!observed)
-                              return;
-
-                          {
-                              *eventComesFromRpc = true;
-                              convertFromVal(value, observed->modifyNow().value());
-                          }
-                          *eventComesFromRpc = false;
+                      "observed_" + std::string(syncId(*observed)),
+                      [weak = std::weak_ptr{observed}, link](Nui::val value) {
+                          if (auto observed = weak.lock(); observed)
+                              link->receive(*observed, value);
                       }),
-                  Nui::smartListen(
+                  Detail::listenForSync(
                       observed,
-                      [eventComesFromRpc = eventComesFromRpc](auto const& value) mutable {
-                          if (!*eventComesFromRpc)
-                              RpcClient::call("observed_" + std::string(syncId(ObservedT{})), convertToVal(value));
+                      [link](Nui::val const& payload) {
+                          link->change(payload);
                       }),
               }
         {}
 
       public:
-        explicit Synchronizer(SharedObservedT& observed)
-            : Synchronizer{observed, std::make_shared<bool>(false)}
+        explicit Synchronizer(SharedObservedT const& observed, SynchronizerOptions const& options = {})
+            : Synchronizer{
+                  std::make_shared<Link>(
+                      options,
+                      Detail::makeSyncScheduler(),
+                      [observed]() {
+                          return Detail::makeSyncPayload(nullptr, observed->value());
+                      },
+                      [name = "observed_" + std::string(syncId(*observed))](Nui::val const& payload) {
+                          RpcClient::call(name, payload);
+                      }),
+                  observed}
         {}
 #else
 
       private:
-        explicit Synchronizer(
-            RpcHub& hub,
-            SharedObservedT const& observed,
-            std::shared_ptr<bool> const& eventComesFromRpc)
+        using Link = Detail::SyncLink<nlohmann::json>;
+
+        explicit Synchronizer(std::shared_ptr<Link> const& link, RpcHub& hub, SharedObservedT const& observed)
             : SynchronizerBase<SharedObservedT>{
                   hub.autoRegisterFunction(
-                      "observed_" + std::string(syncId(observed)),
-                      [weak = std::weak_ptr{observed},
-                       eventComesFromRpc = eventComesFromRpc](nlohmann::json const& value) mutable {
-                          auto observed = weak.lock();
-                          if (!observed)
-                              return;
-
-                          {
-                              *eventComesFromRpc = true;
-                              *observed = value.template get<typename SharedObservedT::value_type::observed_type>();
-                              observed->eventContext().sync();
-                          }
-                          *eventComesFromRpc = false;
+                      "observed_" + std::string(syncId(*observed)),
+                      [weak = std::weak_ptr{observed}, link](nlohmann::json const& value) {
+                          if (auto observed = weak.lock(); observed)
+                              link->receive(*observed, value);
                       }),
-                  Nui::smartListen(
+                  Detail::listenForSync(
                       observed,
-                      [&hub, eventComesFromRpc = eventComesFromRpc](auto const& value) mutable {
-                          if (!*eventComesFromRpc)
-                              hub.call("observed_" + std::string(syncId(ObservedT{})), nlohmann::json(value));
+                      [link](nlohmann::json const& payload) {
+                          link->change(payload);
                       }),
               }
         {}
 
       public:
-        explicit Synchronizer(RpcHub& hub, SharedObservedT const& observed)
-            : Synchronizer{hub, observed, std::make_shared<bool>(false)}
+        explicit Synchronizer(RpcHub& hub, SharedObservedT const& observed, SynchronizerOptions const& options = {})
+            : Synchronizer{
+                  std::make_shared<Link>(
+                      options,
+                      Detail::makeSyncScheduler(hub.window()),
+                      [observed]() {
+                          return Detail::makeSyncPayload(nullptr, observed->value());
+                      },
+                      [&hub, name = "observed_" + std::string(syncId(*observed))](nlohmann::json const& payload) {
+                          hub.call(name, payload);
+                      }),
+                  hub,
+                  observed}
         {}
 #endif
     };
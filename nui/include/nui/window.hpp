@@ -180,6 +180,13 @@ namespace Nui
         // and only execute scripts once, once the view is loaded.
         std::function<void()> onRpcAliveMessage = {};
     };
+
+    struct BindOptions
+    {
+        /// Parse the message and run the function on the thread pool of the window instead of the main thread, so
+        /// that slow functions do not block other calls and the ui. The function has to be thread safe.
+        bool async = false;
+    };
 #else
     struct WindowOptions
     {};
@@ -310,8 +317,12 @@ namespace Nui
          *
          * @param name The name of the function.
          * @param callback The function to bind.
+         * @param options Where the function is executed.
          */
-        void bind(std::string const& name, std::function<void(nlohmann::json const&)> const& callback);
+        void bind(
+            std::string const& name,
+            std::function<void(nlohmann::json const&)> const& callback,
+            BindOptions const& options = {});
 
         /**
          * @brief Unbind a function from the web context.
@@ -322,6 +333,11 @@ namespace Nui
 
         boost::asio::any_io_executor getExecutor() const;
 
+        /**
+         * @brief Passes the message to WindowOptions::onRpcError, for rpc work that runs outside of bound functions.
+         */
+        void reportRpcError(std::string_view message) const;
+
         /**
          * @brief Map a host name under the assets:// scheme to a folder (https:// on windows).
          *
@@ -389,7 +405,8 @@ namespace Nui
         void eval(std::filesystem::path const& file);
 
         /**
-         * @brief Place javascript in the window.
+         * @brief Place javascript in the window. Like eval, calls from other threads are dispatched to the main
+         * thread.
          *
          * @param js
          */
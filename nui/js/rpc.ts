@@ -1,5 +1,22 @@
 export type AnyFunction = (...args: any[]) => any;
 
+export interface RequestOptions {
+    // Time in milliseconds after which the pending call is dropped and the promise is rejected, 0 waits forever.
+    timeout?: number;
+    // Cancels the call, the pending entry is freed and the promise is rejected with the reason of the signal.
+    signal?: AbortSignal;
+}
+
+export interface StreamOptions {
+    // Amount of chunks the backend may send ahead of processing, credit is granted again as chunks are processed.
+    credit?: number;
+}
+
+export interface RpcStream {
+    // Stops the backend from sending more chunks, returns false if the stream already ended.
+    cancel(): boolean;
+}
+
 class RpcClient {
     constructor() {
     }
@@ -13,6 +30,16 @@ class RpcClient {
         }
     };
 
+    // Queues calls to the backend and posts them as one message after the current task or after delay milliseconds.
+    // The order of calls is preserved.
+    public static enableBatching(delay: number = 0) {
+        globalThis.nui_rpc.batching = { delay: delay };
+    }
+
+    public static disableBatching() {
+        globalThis.nui_rpc.batching = undefined;
+    }
+
     private static resolve = (name: string) => {
         const rpcObject = globalThis.nui_rpc;
         if (rpcObject === undefined)
@@ -45,22 +72,66 @@ class RpcClient {
     public static getRemoteCallableWithBackChannel(name: string, cb: AnyFunction)
     {
         return (...args: any[]) : any => {
-            const tempId = globalThis.nui_rpc.tempId + 1;
-            globalThis.nui_rpc.tempId = tempId;
-
-            const tempIdString = `temp_${tempId}`;
-            globalThis.nui_rpc.backend[tempIdString] = (param: any) => {
-                cb(param);
-                delete globalThis.nui_rpc.backend[tempIdString];
-            };
-
             const resolved = RpcClient.resolve(name);
             if (resolved === undefined)
                 return new RpcClient.UnresolvedError(name);
-            return resolved(tempIdString, ...args);
+
+            // The reply is resolved by id from the pending call table installed by the backend.
+            const callId = globalThis.nui_rpc.request(cb, 0);
+            return resolved(`reply_${callId}`, ...args);
         }
     }
 
+    // Calls a function that replies to its first argument, the promise resolves with the reply.
+    public static request(name: string, options: RequestOptions, ...args: any[]): Promise<any> {
+        const resolved = RpcClient.resolve(name);
+        if (resolved === undefined)
+            return Promise.reject(new RpcClient.UnresolvedError(name));
+
+        return globalThis.nui_rpc.requestPromise(
+            (backChannel: string) => resolved(backChannel, ...args),
+            options.timeout ?? 0,
+            options.signal
+        );
+    }
+
+    // Opens a stream of a function registered with RpcHub::registerStream. onEnd is called when the backend closed the
+    // stream, with the error if it failed.
+    public static openStream(
+        name: string,
+        options: StreamOptions,
+        onChunk: (chunk: any) => void,
+        onEnd: (error?: string) => void,
+        ...args: any[]
+    ): RpcStream | InstanceType<typeof RpcClient.UnresolvedError> {
+        if (RpcClient.resolve(name) === undefined)
+            return new RpcClient.UnresolvedError(name);
+
+        // The stream table is installed by the backend and shared with the C++ RpcStreamReader.
+        const credit = options.credit ?? 16;
+        let processed = 0;
+        const id: number = globalThis.nui_rpc.openStream(
+            (chunk: any) => {
+                onChunk(chunk);
+                // Credit is granted in batches of half the window to not answer every chunk.
+                if (globalThis.nui_rpc.isStreamOpen(id) && ++processed >= Math.max(Math.floor(credit / 2), 1)) {
+                    RpcClient.call("Nui::streamCredit", id, processed);
+                    processed = 0;
+                }
+            },
+            (error: string | null) => onEnd(error ?? undefined)
+        );
+        RpcClient.call(name, id, credit, ...args);
+        return {
+            cancel: () => {
+                if (!globalThis.nui_rpc.closeStream(id))
+                    return false;
+                RpcClient.call("Nui::streamCancel", id);
+                return true;
+            }
+        };
+    }
+
     public static call(name: string, ...args: any[]) {
         if (args.length > 0 && typeof args[0] === 'function') {
             const cb = args[0];
@@ -79,21 +150,7 @@ class RpcClient {
 
     // Only use for functions that respond via callback
     public static callAsync(name: string, ...args: any[]): Promise<any> {
-        return new Promise((resolve, reject) => {
-            const callback = (result: any) => {
-                resolve(result);
-            };
-
-            const callable = RpcClient.getRemoteCallableWithBackChannel(name, callback);
-            if (callable instanceof RpcClient.UnresolvedError) {
-                reject(callable);
-            } else {
-                const result = callable(...args);
-                if (result instanceof RpcClient.UnresolvedError) {
-                    reject(result);
-                }
-            }
-        });
+        return RpcClient.request(name, {}, ...args);
     }
 
     public static register(name: string, func: AnyFunction) {
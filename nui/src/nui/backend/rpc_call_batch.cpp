@@ -0,0 +1,93 @@
+#include "rpc_call_batch.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+
+namespace Nui::Detail
+{
+    // #####################################################################################################################
+    RpcCallBatch::RpcCallBatch(Window& window, std::chrono::milliseconds delay)
+        : window_{&window}
+        , delay_{delay}
+        , guard_{}
+        , pending_{}
+        , onEvaluated_{}
+        , scheduled_{false}
+        , closed_{false}
+    {}
+    //---------------------------------------------------------------------------------------------------------------------
+    bool RpcCallBatch::push(std::string const& script, std::function<void()> const& onEvaluated)
+    {
+        bool needsSchedule = false;
+        {
+            std::scoped_lock lock{guard_};
+            // Calls sent directly would overtake the pending ones, so they are queued behind them.
+            if (closed_ && !scheduled_)
+                return false;
+            // Every call is isolated, so that one throwing frontend function does not drop the rest of the batch.
+            pending_ += "try{";
+            pending_ += script;
+            pending_ += "}catch(e){console.error(e);}";
+            if (onEvaluated)
+                onEvaluated_.push_back(onEvaluated);
+            needsSchedule = !scheduled_;
+            scheduled_ = true;
+        }
+        // Scheduling locks the window, which must not happen with the batch locked.
+        if (needsSchedule)
+            schedule();
+        return true;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcCallBatch::flush()
+    {
+        std::string script;
+        std::vector<std::function<void()>> onEvaluated;
+        {
+            std::scoped_lock lock{guard_};
+            script.swap(pending_);
+            onEvaluated.swap(onEvaluated_);
+            scheduled_ = false;
+        }
+        if (!script.empty())
+            window_->eval(script);
+        for (auto const& func : onEvaluated)
+            func();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    bool RpcCallBatch::close()
+    {
+        bool hasPending = false;
+        {
+            std::scoped_lock lock{guard_};
+            closed_ = true;
+            hasPending = scheduled_;
+        }
+        // A delayed flush would hold back direct calls for the rest of the delay. Flushing twice is harmless.
+        if (hasPending && delay_.count() != 0)
+        {
+            window_->dispatch([self = shared_from_this()]() {
+                self->flush();
+            });
+        }
+        return hasPending;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcCallBatch::schedule()
+    {
+        auto dispatchFlush = [self = shared_from_this()]() {
+            self->window_->dispatch([self]() {
+                self->flush();
+            });
+        };
+
+        if (delay_.count() == 0)
+            return dispatchFlush();
+
+        auto timer = std::make_shared<boost::asio::steady_timer>(window_->getExecutor(), delay_);
+        timer->async_wait([timer, dispatchFlush](boost::system::error_code const& error) {
+            if (!error)
+                dispatchFlush();
+        });
+    }
+    // #####################################################################################################################
+}
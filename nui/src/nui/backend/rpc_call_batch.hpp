@@ -0,0 +1,52 @@
+#pragma once
+
+#include <nui/window.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Nui::Detail
+{
+    /**
+     * @brief Collects scripts of calls to the frontend and evaluates them together on the main thread, either on the
+     * next iteration of the main loop or after a delay. Flushes only happen on the main thread, so the order of the
+     * calls is preserved.
+     */
+    class RpcCallBatch : public std::enable_shared_from_this<RpcCallBatch>
+    {
+      public:
+        RpcCallBatch(Window& window, std::chrono::milliseconds delay);
+
+        /**
+         * @brief Queues the script. A closed batch only accepts scripts while a flush is still pending.
+         *
+         * @param onEvaluated Runs on the main thread after the flush that evaluated the script.
+         * @return false if the script was not queued and has to be sent directly.
+         */
+        bool push(std::string const& script, std::function<void()> const& onEvaluated = {});
+        void flush();
+
+        /**
+         * @brief Stops accepting scripts once the pending flush has run and brings that flush forward.
+         *
+         * @return true if a flush is still pending.
+         */
+        bool close();
+
+      private:
+        void schedule();
+
+      private:
+        Window* window_;
+        std::chrono::milliseconds delay_;
+        std::mutex guard_;
+        std::string pending_;
+        std::vector<std::function<void()>> onEvaluated_;
+        bool scheduled_;
+        bool closed_;
+    };
+}
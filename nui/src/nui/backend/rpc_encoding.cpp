@@ -0,0 +1,44 @@
+#include <nui/backend/rpc_encoding.hpp>
+
+namespace Nui::Detail
+{
+    // #####################################################################################################################
+    void appendJsonString(std::string& out, std::string_view str)
+    {
+        constexpr static char const* hexDigits = "0123456789abcdef";
+        out.reserve(out.size() + str.size() + 2);
+        out.push_back('"');
+        for (const char c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        out += "\\u00";
+                        out.push_back(hexDigits[(static_cast<unsigned char>(c) >> 4) & 0xF]);
+                        out.push_back(hexDigits[static_cast<unsigned char>(c) & 0xF]);
+                    }
+                    else
+                        out.push_back(c);
+            }
+        }
+        out.push_back('"');
+    }
+    // #####################################################################################################################
+}
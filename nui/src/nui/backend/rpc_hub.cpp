@@ -1,6 +1,11 @@
 #include <nui/backend/rpc_hub.hpp>
 
 #include <nui/backend/filesystem/file_dialog.hpp>
+#include "rpc_call_batch.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
 #include "rpc_addons/fetch.hpp"
 #include "rpc_addons/file.hpp"
 #include "rpc_addons/throttle.hpp"
@@ -13,7 +18,42 @@ namespace Nui
     // #####################################################################################################################
     RpcHub::RpcHub(Window& window)
         : window_{&window}
-    {}
+        , pendingRequests_{std::make_shared<PendingRequests>()}
+        , streamCreditTimeout_{std::chrono::seconds{30}}
+    {
+        window_->init(std::string{dispatcherScript});
+        registerFunction("Nui::reply", [this](std::uint32_t id, nlohmann::json const& reply) {
+            resolveRequest(id, reply);
+        });
+        registerFunction("Nui::streamCredit", [this](std::uint32_t id, std::uint32_t credit) {
+            std::shared_ptr<RpcStream> stream;
+            {
+                std::scoped_lock lock{streamGuard_};
+                if (auto iter = streams_.find(id); iter != streams_.end())
+                    stream = iter->second.lock();
+            }
+            if (stream)
+                stream->grant(credit);
+        });
+        registerFunction("Nui::streamCancel", [this](std::uint32_t id) {
+            std::shared_ptr<RpcStream> stream;
+            {
+                std::scoped_lock lock{streamGuard_};
+                if (auto iter = streams_.find(id); iter != streams_.end())
+                {
+                    stream = iter->second.lock();
+                    streams_.erase(iter);
+                }
+            }
+            if (stream)
+                stream->cancel();
+        });
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    RpcHub::~RpcHub()
+    {
+        failAllRequests("The rpc hub was destroyed.");
+    }
     //---------------------------------------------------------------------------------------------------------------------
     void RpcHub::enableFileDialogs() const
     {
@@ -110,8 +150,241 @@ namespace Nui
         enableEnvironmentVariables();
     }
     //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::callRemoteImpl(std::string const& name, nlohmann::json const& json) const
+    {
+        dispatch(name, json.dump());
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::callRemoteImpl(std::string const& name) const
+    {
+        dispatch(name, "undefined");
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::dispatch(std::string const& name, std::string const& payload) const
+    {
+        if (name.starts_with(replyPrefix))
+        {
+            const auto callId = std::string_view{name}.substr(std::string_view{replyPrefix}.size());
+            if (!callId.empty() && std::all_of(callId.begin(), callId.end(), [](char c) {
+                    return c >= '0' && c <= '9';
+                }))
+            {
+                send(fmt::format("globalThis.nui_rpc.reply({},{});", callId, payload));
+                return;
+            }
+        }
+
+        if (name.starts_with(temporaryFunctionPrefix))
+        {
+            send(fmt::format("globalThis.nui_rpc.dispatch({},{});", nlohmann::json(name).dump(), payload));
+            return;
+        }
+
+        std::size_t id = 0;
+        std::shared_ptr<std::atomic_bool> defined;
+        bool created = false;
+        {
+            std::scoped_lock lock{dispatchGuard_};
+            auto iter = functionIds_.find(name);
+            if (iter == functionIds_.end())
+            {
+                id = functionIds_.size();
+                defined = std::make_shared<std::atomic_bool>(false);
+                functionIds_.emplace(name, FunctionId{.id = id, .defined = defined});
+                created = true;
+            }
+            else
+            {
+                id = iter->second.id;
+                defined = iter->second.defined;
+            }
+        }
+
+        // Later page loads know the id from the start.
+        if (created)
+            window_->init(fmt::format("globalThis.nui_rpc.define({},{});", id, nlohmann::json(name).dump()));
+
+        if (defined->load())
+        {
+            send(fmt::format("globalThis.nui_rpc.dispatch({},{});", id, payload));
+            return;
+        }
+
+        // Defining is idempotent, so every call carries the definition until one of them was evaluated.
+        send(
+            fmt::format(
+                "globalThis.nui_rpc.define({0},{1});globalThis.nui_rpc.dispatch({0},{2});",
+                id,
+                nlohmann::json(name).dump(),
+                payload),
+            [defined]() {
+                defined->store(true);
+            });
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::send(std::string const& script, std::function<void()> onEvaluated) const
+    {
+        std::shared_ptr<Detail::RpcCallBatch> batch;
+        {
+            std::scoped_lock lock{dispatchGuard_};
+            batch = batch_;
+        }
+        if (batch)
+        {
+            if (batch->push(script, onEvaluated))
+                return;
+            // Only a closed batch that has flushed rejects scripts, it is not needed anymore.
+            std::scoped_lock lock{dispatchGuard_};
+            if (batch_ == batch)
+                batch_.reset();
+        }
+        // window is threadsafe.
+        window_->eval(script);
+        // Evaluations from other threads are dispatched to the main thread as well, this runs after them.
+        if (onEvaluated)
+            window_->dispatch(std::move(onEvaluated));
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    std::pair<std::uint32_t, std::future<nlohmann::json>> RpcHub::registerRequest() const
+    {
+        std::scoped_lock lock{pendingRequests_->guard};
+        const auto id = ++pendingRequests_->lastId;
+        auto& pending = pendingRequests_->requests[id];
+        if (pendingRequests_->timeout.count() != 0)
+        {
+            pending.timeout =
+                std::make_shared<boost::asio::steady_timer>(window_->getExecutor(), pendingRequests_->timeout);
+            pending.timeout->async_wait([weakRequests = std::weak_ptr{pendingRequests_}, id](
+                                            boost::system::error_code const& error) {
+                // The timer is cancelled when the request ends otherwise. A handler that expired before that may
+                // still be queued, so it only acts if the requests are still there.
+                if (error)
+                    return;
+                if (auto requests = weakRequests.lock())
+                    requests->fail(id, "Rpc request timed out.");
+            });
+        }
+        return {id, pending.promise.get_future()};
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::resolveRequest(std::uint32_t id, nlohmann::json const& reply) const
+    {
+        PendingRequest pending;
+        {
+            std::scoped_lock lock{pendingRequests_->guard};
+            auto iter = pendingRequests_->requests.find(id);
+            if (iter == pendingRequests_->requests.end())
+                return;
+            pending = std::move(iter->second);
+            pendingRequests_->requests.erase(iter);
+        }
+        if (pending.timeout)
+            pending.timeout->cancel();
+        pending.promise.set_value(reply);
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::PendingRequests::fail(std::uint32_t id, std::string const& reason)
+    {
+        PendingRequest pending;
+        {
+            std::scoped_lock lock{guard};
+            auto iter = requests.find(id);
+            if (iter == requests.end())
+                return;
+            pending = std::move(iter->second);
+            requests.erase(iter);
+        }
+        pending.promise.set_exception(std::make_exception_ptr(RpcRequestError{reason}));
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::failAllRequests(std::string const& reason) const
+    {
+        std::unordered_map<std::uint32_t, PendingRequest> pendingRequests;
+        {
+            std::scoped_lock lock{pendingRequests_->guard};
+            pendingRequests.swap(pendingRequests_->requests);
+        }
+        for (auto& [id, pending] : pendingRequests)
+        {
+            if (pending.timeout)
+                pending.timeout->cancel();
+            pending.promise.set_exception(std::make_exception_ptr(RpcRequestError{reason}));
+        }
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    std::shared_ptr<RpcStream> RpcHub::openStream(std::uint32_t id, std::uint32_t credit) const
+    {
+        std::scoped_lock lock{streamGuard_};
+        auto stream = std::make_shared<RpcStream>(*this, id, credit, streamCreditTimeout_);
+        streams_[id] = stream;
+        return stream;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::closeStream(std::uint32_t id) const
+    {
+        std::scoped_lock lock{streamGuard_};
+        streams_.erase(id);
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::cancelAllStreams() const
+    {
+        std::unordered_map<std::uint32_t, std::weak_ptr<RpcStream>> streams;
+        {
+            std::scoped_lock lock{streamGuard_};
+            streams.swap(streams_);
+        }
+        for (auto& [id, weakStream] : streams)
+        {
+            if (auto stream = weakStream.lock())
+                stream->cancel();
+        }
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::enableBatching(std::chrono::milliseconds delay)
+    {
+        std::shared_ptr<Detail::RpcCallBatch> previous;
+        {
+            std::scoped_lock lock{dispatchGuard_};
+            previous = std::exchange(batch_, std::make_shared<Detail::RpcCallBatch>(*window_, delay));
+        }
+        if (previous)
+            previous->close();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::disableBatching()
+    {
+        std::shared_ptr<Detail::RpcCallBatch> batch;
+        {
+            std::scoped_lock lock{dispatchGuard_};
+            batch = batch_;
+        }
+        // The closed batch keeps taking calls until its pending flush ran, so that the order of calls is kept. It is
+        // dropped by the first call it rejects.
+        if (batch && !batch->close())
+        {
+            std::scoped_lock lock{dispatchGuard_};
+            if (batch_ == batch)
+                batch_.reset();
+        }
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::setRequestTimeout(std::chrono::milliseconds timeout)
+    {
+        std::scoped_lock lock{pendingRequests_->guard};
+        pendingRequests_->timeout = timeout;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcHub::setStreamCreditTimeout(std::chrono::milliseconds timeout)
+    {
+        std::scoped_lock lock{streamGuard_};
+        streamCreditTimeout_ = timeout;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
     void RpcHub::markRpcAsInitialized()
     {
+        // The frontend that would reply to these or grant credit is gone.
+        failAllRequests("The page was reloaded before the rpc request was answered.");
+        cancelAllStreams();
         window_->eval(R"(
             if (typeof globalThis.nui_rpc !== 'undefined') {
                 globalThis.nui_rpc.initialized = true;
@@ -0,0 +1,192 @@
+#include <nui/backend/rpc_stream.hpp>
+#include <nui/backend/rpc_hub.hpp>
+
+#include <boost/asio/post.hpp>
+
+#include <exception>
+#include <utility>
+
+namespace Nui
+{
+    // #####################################################################################################################
+    RpcStream::RpcStream(
+        RpcHub const& hub,
+        std::uint32_t id,
+        std::uint32_t credit,
+        std::chrono::milliseconds creditTimeout)
+        : hub_{&hub}
+        , id_{id}
+        , guard_{}
+        , credit_{credit}
+        , creditTimeout_{creditTimeout}
+        , state_{State::Open}
+        , continuation_{}
+        , creditTimer_{}
+    {}
+    //---------------------------------------------------------------------------------------------------------------------
+    RpcStream::~RpcStream()
+    {
+        close();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    bool RpcStream::write(nlohmann::json const& chunk)
+    {
+        {
+            std::scoped_lock lock{guard_};
+            if (state_ != State::Open || credit_ == 0)
+                return false;
+            --credit_;
+        }
+        hub_->callRemote("Nui::streamChunk", id_, chunk);
+        return true;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    bool RpcStream::canWrite() const
+    {
+        std::scoped_lock lock{guard_};
+        return state_ == State::Open && credit_ > 0;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::whenWritable(std::function<void()> continuation)
+    {
+        std::shared_ptr<boost::asio::steady_timer> previousTimer;
+        {
+            std::scoped_lock lock{guard_};
+            if (state_ != State::Open)
+                return;
+            if (credit_ != 0)
+                return post(std::move(continuation));
+
+            continuation_ = std::move(continuation);
+            previousTimer = std::exchange(creditTimer_, nullptr);
+            if (creditTimeout_.count() != 0)
+            {
+                creditTimer_ =
+                    std::make_shared<boost::asio::steady_timer>(hub_->window().getExecutor(), creditTimeout_);
+                creditTimer_->async_wait(
+                    [weakSelf = weak_from_this(), timer = creditTimer_.get()](boost::system::error_code const& error) {
+                        if (error)
+                            return;
+                        if (auto self = weakSelf.lock())
+                            self->creditTimedOut(timer);
+                    });
+            }
+        }
+        if (previousTimer)
+            previousTimer->cancel();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::close()
+    {
+        finish(nullptr);
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::fail(std::string const& error)
+    {
+        finish(error);
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    bool RpcStream::isCancelled() const
+    {
+        std::scoped_lock lock{guard_};
+        return state_ == State::Cancelled;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    std::uint32_t RpcStream::id() const
+    {
+        return id_;
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::grant(std::uint32_t credit)
+    {
+        {
+            std::scoped_lock lock{guard_};
+            credit_ += credit;
+        }
+        resume();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::cancel()
+    {
+        {
+            std::scoped_lock lock{guard_};
+            if (state_ != State::Open)
+                return;
+            state_ = State::Cancelled;
+        }
+        dropContinuation();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::finish(nlohmann::json const& error)
+    {
+        {
+            std::scoped_lock lock{guard_};
+            if (state_ != State::Open)
+                return;
+            state_ = State::Closed;
+        }
+        hub_->closeStream(id_);
+        hub_->callRemote("Nui::streamEnd", id_, error);
+        dropContinuation();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::resume()
+    {
+        std::function<void()> continuation;
+        std::shared_ptr<boost::asio::steady_timer> timer;
+        {
+            std::scoped_lock lock{guard_};
+            if (!continuation_ || state_ != State::Open || credit_ == 0)
+                return;
+            continuation = std::exchange(continuation_, nullptr);
+            timer = std::exchange(creditTimer_, nullptr);
+        }
+        if (timer)
+            timer->cancel();
+        post(std::move(continuation));
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::dropContinuation()
+    {
+        std::function<void()> continuation;
+        std::shared_ptr<boost::asio::steady_timer> timer;
+        {
+            std::scoped_lock lock{guard_};
+            continuation = std::exchange(continuation_, nullptr);
+            timer = std::exchange(creditTimer_, nullptr);
+        }
+        // The continuation usually holds the stream, it is released outside of the lock.
+        if (timer)
+            timer->cancel();
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::creditTimedOut(boost::asio::steady_timer const* timer)
+    {
+        {
+            std::scoped_lock lock{guard_};
+            // Credit that arrived while the handler was queued already resumed the producer.
+            if (creditTimer_.get() != timer)
+                return;
+        }
+        fail("Timed out waiting for credit.");
+    }
+    //---------------------------------------------------------------------------------------------------------------------
+    void RpcStream::post(std::function<void()> continuation)
+    {
+        boost::asio::post(
+            hub_->window().getExecutor(), [self = shared_from_this(), continuation = std::move(continuation)]() {
+                try
+                {
+                    continuation();
+                }
+                catch (std::exception const& exc)
+                {
+                    // Would otherwise terminate, the pool has nothing to report it to.
+                    self->fail(exc.what());
+                    self->hub_->window().reportRpcError(
+                        std::string{"Exception in rpc stream continuation\nException: "} + exc.what());
+                }
+            });
+    }
+    // #####################################################################################################################
+}
@@ -31,6 +31,8 @@
 #endif
 
 #include <random>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <fstream>
 #include <filesystem>
@@ -111,6 +113,49 @@ using namespace std::string_literals;
 // #####################################################################################################################
 namespace Nui
 {
+    namespace
+    {
+        // Messages of functions bound as async start with this, so they can be handed to the pool without parsing.
+        constexpr std::string_view asyncRpcMessagePrefix = R"({"type":"rpc_async")";
+
+        // Sends rpc messages to the backend. While nui_rpc.batching is set to {delay}, messages are queued and posted
+        // together as one rpc_batch message, after the current task or after delay milliseconds.
+        constexpr char const* rpcPostScript = R"(
+            (() => {
+                globalThis.nui_rpc = (globalThis.nui_rpc || {frontend: {}, backend: {}, tempId: 0, initialized: false});
+                if (globalThis.nui_rpc.post !== undefined)
+                    return;
+
+                let queue = [];
+                const flush = () => {
+                    const messages = queue;
+                    queue = [];
+                    if (messages.length === 1)
+                        globalThis.__webview__.post(JSON.stringify(messages[0]));
+                    else if (messages.length > 1)
+                        globalThis.__webview__.post(JSON.stringify({type: "rpc_batch", messages: messages}));
+                };
+                globalThis.nui_rpc.post = (message) => {
+                    const batching = globalThis.nui_rpc.batching;
+                    if (batching === undefined || batching === null) {
+                        // Queued messages go first to keep the order.
+                        flush();
+                        globalThis.__webview__.post(JSON.stringify(message));
+                        return;
+                    }
+
+                    queue.push(message);
+                    if (queue.length !== 1)
+                        return;
+                    if (batching.delay > 0)
+                        setTimeout(flush, batching.delay);
+                    else
+                        queueMicrotask(flush);
+                };
+            })();
+        )";
+    }
+
     struct Window::Implementation : public std::enable_shared_from_this<Implementation>
     {
         std::recursive_mutex viewGuard;
@@ -123,6 +168,7 @@ namespace Nui
         std::function<void(std::string_view)> onRpcError;
         std::function<void()> onRpcAliveMessage;
         bool isRunning{false};
+        std::thread::id mainThreadId{};
 
         virtual void registerSchemeHandlers(WindowOptions const& options) = 0;
 
@@ -148,6 +194,42 @@ namespace Nui
             pool.join();
         }
 
+        void callRpc(nlohmann::json const& obj)
+        {
+            if (!obj.contains("id"))
+                return onRpcError("Message does not contain a callback id!");
+
+            const auto id = obj["id"].get<std::string>();
+            std::function<void(nlohmann::json const&)> callback;
+            {
+                std::scoped_lock lock{viewGuard};
+                auto callbackIter = callbacks.find(id);
+                if (callbackIter == callbacks.end())
+                    return onRpcError("Callback with id " + id + " does not exist!");
+                callback = callbackIter->second;
+            }
+
+            if (!obj.contains("args"))
+                callback(nlohmann::json{});
+            else
+                callback(obj["args"]);
+        }
+
+        void callRpcOnPool(nlohmann::json obj)
+        {
+            boost::asio::post(pool, [this, obj = std::move(obj)]() {
+                try
+                {
+                    callRpc(obj);
+                }
+                catch (std::exception const& exc)
+                {
+                    onRpcError(
+                        "Exception in async rpc handler for message: " + obj.dump() + "\nException: " + exc.what());
+                }
+            });
+        }
+
         void initialize(bool debug, std::function<void*(void*)> onConfigure)
         {
             view = std::make_unique<webview::webview>(debug, nullptr, std::move(onConfigure));
@@ -242,6 +324,23 @@ namespace Nui
 #endif
 
         impl_->view->install_message_hook([this](std::string const& msg) {
+            if (std::string_view{msg}.starts_with(asyncRpcMessagePrefix))
+            {
+                // Parsed on the pool as well, the view stays unlocked.
+                boost::asio::post(impl_->pool, [impl = impl_.get(), msg]() {
+                    try
+                    {
+                        impl->callRpc(nlohmann::json::parse(msg));
+                    }
+                    catch (std::exception const& exc)
+                    {
+                        impl->onRpcError(
+                            "Exception in async rpc handler for message: " + msg + "\nException: " + exc.what());
+                    }
+                });
+                return false;
+            }
+
             std::scoped_lock lock{impl_->viewGuard};
             try
             {
@@ -254,18 +353,29 @@ namespace Nui
                     return false;
                 }
 
-                if (!obj.contains("id"))
-                    return impl_->onRpcError("Message does not contain a callback id!"), false;
-
-                const auto id = obj["id"].get<std::string>();
-                auto callbackIter = impl_->callbacks.find(id);
-                if (callbackIter == impl_->callbacks.end())
-                    return impl_->onRpcError("Callback with id " + id + " does not exist!"), false;
+                if (type != obj.end() && type->is_string() && type->get<std::string>() == "rpc_batch")
+                {
+                    // Calls queued by the frontend within one tick, each one is handled on its own.
+                    for (auto const& message : obj["messages"])
+                    {
+                        try
+                        {
+                            if (message.value("type", "") == "rpc_async")
+                                impl_->callRpcOnPool(message);
+                            else
+                                impl_->callRpc(message);
+                        }
+                        catch (std::exception const& exc)
+                        {
+                            impl_->onRpcError(
+                                "Exception in webview message handler for batched message: " + message.dump() +
+                                "\nException: " + exc.what());
+                        }
+                    }
+                    return false;
+                }
 
-                if (!obj.contains("args"))
-                    callbackIter->second(nlohmann::json{});
-                else
-                    callbackIter->second(obj["args"]);
+                impl_->callRpc(obj);
             }
             catch (std::exception const& exc)
             {
@@ -274,6 +384,7 @@ namespace Nui
             }
             return false;
         });
+        impl_->view->init(rpcPostScript);
 
         impl_->registerSchemeHandlers(options);
 
@@ -465,6 +576,7 @@ namespace Nui
     //---------------------------------------------------------------------------------------------------------------------
     void Window::run()
     {
+        impl_->mainThreadId = std::this_thread::get_id();
         impl_->isRunning = true;
 #ifdef _WIN32
         auto* winImpl = static_cast<WindowsImplementation*>(impl_.get());
@@ -561,12 +673,15 @@ namespace Nui
             true);
     }
     //---------------------------------------------------------------------------------------------------------------------
-    void Window::bind(std::string const& name, std::function<void(nlohmann::json const&)> const& callback)
+    void Window::bind(
+        std::string const& name,
+        std::function<void(nlohmann::json const&)> const& callback,
+        BindOptions const& options)
     {
         if (!callback)
             throw std::runtime_error("Callback must be valid.");
 
-        runInJavascriptThread([this, name, callback]() {
+        runInJavascriptThread([this, name, callback, async = options.async]() {
             std::scoped_lock lock{impl_->viewGuard};
             impl_->callbacks[name] = callback;
             auto script = fmt::format(
@@ -574,21 +689,23 @@ namespace Nui
                     (() => {{
                         const name = "{}";
                         const id = "{}";
+                        const type = "{}";
                         globalThis.nui_rpc = (globalThis.nui_rpc || {{
                             frontend: {{}}, backend: {{}}, tempId: 0, initialized: false
                         }});
                         globalThis.nui_rpc.backend[name] = (...args) => {{
-                            globalThis.__webview__.post(JSON.stringify({{
-                                type: "rpc",
+                            globalThis.nui_rpc.post({{
+                                type: type,
                                 name: name,
                                 id: id,
                                 args: [...args]
-                            }}));
+                            }});
                         }};
                     }})();
                 )",
                 name,
-                name);
+                name,
+                async ? "rpc_async" : "rpc");
 
             if (!impl_->isRunning)
                 impl_->view->init(script);
@@ -648,7 +765,30 @@ namespace Nui
     void Window::init(std::string const& js)
     {
         std::scoped_lock lock{impl_->viewGuard};
+#if defined(_WIN32)
+        auto* winImpl = static_cast<WindowsImplementation*>(impl_.get());
+        if (GetCurrentThreadId() == winImpl->windowThreadId)
+        {
+            winImpl->view->init(js);
+        }
+        else
+        {
+            winImpl->toProcessOnWindowThread.emplace_back([js, winImpl]() {
+                winImpl->view->init(js);
+            });
+            PostThreadMessage(winImpl->windowThreadId, wakeUpMessage, 0, 0);
+        }
+#else
+        if (impl_->isRunning && std::this_thread::get_id() != impl_->mainThreadId)
+        {
+            // Same as eval, e.g. function definitions made by the first call from an async rpc handler.
+            impl_->view->dispatch([view = impl_->view.get(), js]() {
+                view->init(js);
+            });
+            return;
+        }
         impl_->view->init(js);
+#endif
     }
     //---------------------------------------------------------------------------------------------------------------------
     void Window::init(std::filesystem::path const& file)
@@ -681,9 +821,15 @@ namespace Nui
             });
             PostThreadMessage(winImpl->windowThreadId, wakeUpMessage, 0, 0);
         }
-#elif defined(__APPLE__)
-        impl_->view->eval(js);
 #else
+        if (impl_->isRunning && std::this_thread::get_id() != impl_->mainThreadId)
+        {
+            // E.g. replies of async rpc handlers, the view may only be used from the main thread.
+            impl_->view->dispatch([view = impl_->view.get(), js]() {
+                view->eval(js);
+            });
+            return;
+        }
         impl_->view->eval(js);
 #endif
     }
@@ -795,6 +941,11 @@ namespace Nui
     {
         return impl_->pool.executor();
     }
+    //---------------------------------------------------------------------------------------------------------------------
+    void Window::reportRpcError(std::string_view message) const
+    {
+        impl_->onRpcError(message);
+    }
     // #####################################################################################################################
 }
 
@@ -1,6 +1,23 @@
 #include <nui/event_system/event_context.hpp>
+#include <nui/event_system/observed_value.hpp>
 
 namespace Nui
 {
     thread_local EventContext globalEventContext;
+
+    void EventContext::endTransaction()
+    {
+        auto& registry = impl_->eventRegistry();
+        if (!registry.endTransaction())
+            return;
+
+        for (auto const* observed : registry.takeDeferredUpdates())
+        {
+            if (observed != nullptr)
+                observed->commitDeferredUpdate();
+        }
+
+        if (registry.takeFlushRequest())
+            registry.executeActiveEvents();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <nui/frontend/api/intersection_observer.hpp>
+
+#include <nui/frontend/utility/functions.hpp>
+
+namespace Nui::WebApi
+{
+    namespace
+    {
+        Nui::val makeOptions(IntersectionObserver::Options const& options)
+        {
+            Nui::val optionsVal = Nui::val::object();
+            if (options.root)
+                optionsVal.set("root", *options.root);
+            optionsVal.set("rootMargin", options.rootMargin);
+            if (!options.thresholds.empty())
+            {
+                Nui::val thresholds = Nui::val::array();
+                for (auto const threshold : options.thresholds)
+                    thresholds.call<void>("push", threshold);
+                optionsVal.set("threshold", thresholds);
+            }
+            return optionsVal;
+        }
+    }
+
+    IntersectionObserver::IntersectionObserver(
+        std::function<void(std::vector<IntersectionObserverEntry> const&, IntersectionObserver const&)> callback)
+        : IntersectionObserver{std::move(callback), Options{}}
+    {}
+    IntersectionObserver::IntersectionObserver(
+        std::function<void(std::vector<IntersectionObserverEntry> const&, IntersectionObserver const&)> callback,
+        Options const& options)
+        : ValWrapper{Nui::val::global("IntersectionObserver")
+                         .new_(
+                             Nui::bind(
+                                 [this](Nui::val entriesVal, Nui::val) {
+                                     std::vector<IntersectionObserverEntry> entries;
+                                     for (auto const& entryVal : entriesVal)
+                                     {
+                                         entries.emplace_back(entryVal);
+                                     }
+                                     callback_(entries, *this);
+                                 },
+                                 std::placeholders::_1,
+                                 std::placeholders::_2),
+                             makeOptions(options))}
+        , callback_{std::move(callback)}
+    {}
+    IntersectionObserver::IntersectionObserver(Nui::val event)
+        : ValWrapper(std::move(event))
+        , callback_{}
+    {}
+    IntersectionObserver::~IntersectionObserver()
+    {
+        if (moveDetector_.wasMoved())
+            return;
+
+        if (!val_.isNull() && !val_.isUndefined())
+            disconnect();
+    }
+    void IntersectionObserver::disconnect() const
+    {
+        val_.call<void>("disconnect");
+    }
+    void IntersectionObserver::observe(Nui::val target) const
+    {
+        val_.call<void>("observe", target);
+    }
+    void IntersectionObserver::unobserve(Nui::val target) const
+    {
+        val_.call<void>("unobserve", target);
+    }
+    std::vector<IntersectionObserverEntry> IntersectionObserver::takeRecords() const
+    {
+        std::vector<IntersectionObserverEntry> entries;
+        for (auto const& entryVal : val_.call<Nui::val>("takeRecords"))
+            entries.emplace_back(entryVal);
+        return entries;
+    }
+}
@@ -0,0 +1,45 @@
+#include <nui/frontend/api/intersection_observer_entry.hpp>
+
+namespace Nui::WebApi
+{
+    IntersectionObserverEntry::IntersectionObserverEntry(Nui::val event)
+        : ValWrapper{std::move(event)}
+    {}
+
+    DomRectReadOnly IntersectionObserverEntry::boundingClientRect() const
+    {
+        return DomRectReadOnly{val_["boundingClientRect"]};
+    }
+
+    double IntersectionObserverEntry::intersectionRatio() const
+    {
+        return val_["intersectionRatio"].as<double>();
+    }
+
+    DomRectReadOnly IntersectionObserverEntry::intersectionRect() const
+    {
+        return DomRectReadOnly{val_["intersectionRect"]};
+    }
+
+    bool IntersectionObserverEntry::isIntersecting() const
+    {
+        return val_["isIntersecting"].as<bool>();
+    }
+
+    std::optional<DomRectReadOnly> IntersectionObserverEntry::rootBounds() const
+    {
+        if (val_["rootBounds"].isNull() || val_["rootBounds"].isUndefined())
+            return std::nullopt;
+        return DomRectReadOnly{val_["rootBounds"]};
+    }
+
+    Nui::val IntersectionObserverEntry::target() const
+    {
+        return val_["target"];
+    }
+
+    double IntersectionObserverEntry::time() const
+    {
+        return val_["time"].as<double>();
+    }
+}
@@ -12,6 +12,8 @@ namespace Nui
     // #####################################################################################################################
     void Attribute::setOn(Dom::ChildlessElement& element) const
     {
+        if (auto const* staticAttribute = std::get_if<StaticAttribute>(&attributeImpl_); staticAttribute)
+            return staticAttribute->setOn(element);
         std::get<RegularAttribute>(attributeImpl_).setter(element);
     }
     //---------------------------------------------------------------------------------------------------------------------
@@ -41,6 +43,13 @@ namespace Nui
                     arg.setter(elem);
                     return textVal["nodeValue"].as<std::string>();
                 }
+                else if constexpr (std::is_same_v<T, StaticAttribute>)
+                {
+                    auto textVal = Nui::val::object();
+                    Dom::ChildlessElement elem{textVal};
+                    arg.setOn(elem);
+                    return textVal["nodeValue"].as<std::string>();
+                }
                 else
                 {
                     return {};
@@ -54,6 +63,11 @@ namespace Nui
         return std::holds_alternative<RegularAttribute>(attributeImpl_);
     }
     //---------------------------------------------------------------------------------------------------------------------
+    bool Attribute::isStatic() const
+    {
+        return std::holds_alternative<StaticAttribute>(attributeImpl_);
+    }
+    //---------------------------------------------------------------------------------------------------------------------
     bool Attribute::isStringData() const
     {
         return std::holds_alternative<StringDataAttribute>(attributeImpl_);
@@ -12,6 +12,8 @@ set(NUI_FRONTEND_SOURCES_RELATIVE
     api/abort_controller.cpp
     api/resize_observer.cpp
     api/resize_observer_entry.cpp
+    api/intersection_observer.cpp
+    api/intersection_observer_entry.cpp
     api/data_transfer_item_list.cpp
     api/data_transfer.cpp
     api/data_transfer_item.cpp
@@ -28,8 +30,10 @@ set(NUI_FRONTEND_SOURCES_RELATIVE
     filesystem/file_dialog.cpp
     filesystem/file.cpp
     utility/fragment_listener.cpp
+    utility/idle_event_cleanup.cpp
     utility/functions.cpp
     utility/stabilize.cpp
+    utility/lazy.cpp
     window.cpp
     screen.cpp
     environment_variables.cpp
@@ -0,0 +1,45 @@
+#include <nui/frontend/utility/idle_event_cleanup.hpp>
+
+#include <nui/frontend/utility/functions.hpp>
+#include <nui/frontend/val.hpp>
+
+namespace Nui
+{
+    namespace
+    {
+        constexpr double minimumIdleMilliseconds = 1.;
+
+        void scheduleIdleCleanupSlice(std::size_t eventsPerSlice, EventContext& ctx);
+
+        void idleCleanupSlice(Nui::val deadline, std::size_t eventsPerSlice, EventContext& ctx)
+        {
+            const bool hasDeadline = !deadline.isUndefined() && !deadline.isNull();
+            do
+            {
+                if (ctx.cleanInvalidEvents(eventsPerSlice))
+                    return;
+            } while (hasDeadline && deadline.call<Nui::val>("timeRemaining").as<double>() > minimumIdleMilliseconds);
+
+            scheduleIdleCleanupSlice(eventsPerSlice, ctx);
+        }
+
+        void scheduleIdleCleanupSlice(std::size_t eventsPerSlice, EventContext& ctx)
+        {
+            auto callback = Nui::bind(
+                [eventsPerSlice, &ctx](Nui::val deadline) {
+                    idleCleanupSlice(std::move(deadline), eventsPerSlice, ctx);
+                },
+                std::placeholders::_1);
+
+            if (Nui::val::global("requestIdleCallback").isUndefined())
+                Nui::val::global("setTimeout")(callback, 0);
+            else
+                Nui::val::global("requestIdleCallback")(callback);
+        }
+    }
+
+    void cleanInvalidEventsWhenIdle(std::size_t eventsPerSlice, EventContext& ctx)
+    {
+        scheduleIdleCleanupSlice(eventsPerSlice == 0 ? 1 : eventsPerSlice, ctx);
+    }
+}
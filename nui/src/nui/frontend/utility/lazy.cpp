@@ -0,0 +1,100 @@
+#include <nui/frontend/utility/lazy.hpp>
+
+#include <nui/frontend/elements/impl/html_element.hpp>
+
+namespace Nui
+{
+    LazyElement::LazyElement()
+        : LazyElement{Options{}}
+    {}
+
+    LazyElement::LazyElement(Options options)
+        : options_{std::move(options)}
+        , observer_{}
+        , element_{}
+        , renderer_{}
+        , materialized_{false}
+    {}
+
+    bool LazyElement::materialized() const
+    {
+        return materialized_;
+    }
+
+    void LazyElement::materialize()
+    {
+        auto element = element_.lock();
+        if (!element || materialized_ || !renderer_)
+            return;
+
+        observer_->unobserve(element->val());
+        element->replaceElement(*renderer_);
+        materialized_ = true;
+        if (options_.dematerializeWhenHidden)
+            observer_->observe(element->val());
+    }
+
+    void LazyElement::dematerialize()
+    {
+        auto element = element_.lock();
+        if (!element || !materialized_)
+            return;
+
+        observer_->unobserve(element->val());
+        element->replaceElement(placeholder());
+        materialized_ = false;
+        observer_->observe(element->val());
+    }
+
+    void LazyElement::watch(std::shared_ptr<Dom::Element> const& element)
+    {
+        if (!observer_)
+        {
+            observer_.emplace(
+                [this](
+                    std::vector<WebApi::IntersectionObserverEntry> const& entries,
+                    WebApi::IntersectionObserver const&) {
+                    onIntersection(entries);
+                },
+                WebApi::IntersectionObserver::Options{.rootMargin = options_.rootMargin});
+        }
+        else if (auto previous = element_.lock(); previous)
+        {
+            observer_->unobserve(previous->val());
+        }
+
+        element_ = element;
+        materialized_ = false;
+        observer_->observe(element->val());
+    }
+
+    void LazyElement::onIntersection(std::vector<WebApi::IntersectionObserverEntry> const& entries)
+    {
+        // Only one target is observed, the last entry is the most recent state.
+        if (entries.empty())
+            return;
+
+        if (entries.back().isIntersecting())
+            materialize();
+        else if (options_.dematerializeWhenHidden)
+            dematerialize();
+    }
+
+    ElementRenderer LazyElement::placeholder() const
+    {
+        if (options_.placeholder)
+            return *options_.placeholder;
+        return HtmlElement{"div", &RegularHtmlElementBridge}();
+    }
+
+    ElementRenderer lazy(LazyElement& lazyElement, ElementRenderer const& encapsulatedRenderer)
+    {
+        return [encapsulatedRenderer,
+                &lazyElement](Dom::Element& actualParent, Renderer const& gen) -> std::shared_ptr<Dom::Element> {
+            lazyElement.renderer_ = encapsulatedRenderer;
+            auto element = lazyElement.placeholder()(actualParent, gen);
+            lazyElement.watch(element);
+            return element;
+        };
+    }
+}
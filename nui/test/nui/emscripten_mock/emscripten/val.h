@@ -84,11 +84,17 @@ namespace emscripten
             return *this;
         }
 
+        template <typename T>
+        static constexpr bool isConvertedNumber = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+            !std::is_same_v<T, long long> && !std::is_same_v<T, long double>;
+
         template <typename T>
         auto as() const& -> decltype(auto)
         {
             if constexpr (std::is_same_v<T, val>)
                 return *this;
+            else if constexpr (isConvertedNumber<T>)
+                return Nui::Tests::Engine::allValues[*referenced_value_].template asNumber<T>();
             else
                 return Nui::Tests::Engine::allValues[*referenced_value_].template as<T const&>();
         }
@@ -98,6 +104,8 @@ namespace emscripten
         {
             if constexpr (std::is_same_v<T, val>)
                 return *this;
+            else if constexpr (isConvertedNumber<T>)
+                return Nui::Tests::Engine::allValues[*referenced_value_].template asNumber<T>();
             else
                 return withValueDo([](auto& value) -> decltype(auto) {
                     return value.template as<T&>();
@@ -109,6 +117,8 @@ namespace emscripten
         {
             if constexpr (std::is_same_v<T, val>)
                 return *this;
+            else if constexpr (isConvertedNumber<T>)
+                return Nui::Tests::Engine::allValues[*referenced_value_].template asNumber<T>();
             else
                 return withValueDo([](auto&& value) -> T {
                     return value.template as<T>();
@@ -146,6 +156,8 @@ namespace emscripten
             auto fn = [key](Nui::Tests::Engine::Value const& value) {
                 if (value.type() == Nui::Tests::Engine::Value::Type::Object)
                     return value.template as<Nui::Tests::Engine::Object const&>().reference(key);
+                else if (value.type() == Nui::Tests::Engine::Value::Type::Array)
+                    return value.template as<Nui::Tests::Engine::Array const&>().asObject().reference(key);
                 else
                     throw std::runtime_error{"val::operator[]: value is not an object"};
             };
@@ -222,6 +234,17 @@ namespace emscripten
                     else
                         throw std::runtime_error{"val::call of "s + name + ": " + mem.typeOf() + " is not a function"};
                 }
+                else if (value.type() == Nui::Tests::Engine::Value::Type::Array && std::string{name} == "push")
+                {
+                    if constexpr (std::is_same_v<Ret, void> && (std::is_same_v<std::decay_t<List>, val> && ...))
+                    {
+                        auto& array = value.template as<Nui::Tests::Engine::Array&>();
+                        (array.push_back(args.handle()), ...);
+                        return;
+                    }
+                    else
+                        throw std::runtime_error{"val::call: push is only supported for val arguments"};
+                }
                 else if (value.type() == Nui::Tests::Engine::Value::Type::Function)
                 {
                     // so far only used to bind this correctly for functions.
@@ -515,6 +538,11 @@ namespace emscripten
         }
         void operator++()
         {
+            if (index_ >= static_cast<std::size_t>(v_["length"].template as<long long>()))
+            {
+                cur_value_.referenced_value_.reset();
+                return;
+            }
             cur_value_ = v_[static_cast<int>(index_)];
             ++index_;
         }
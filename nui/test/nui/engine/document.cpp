@@ -103,10 +103,83 @@ namespace Nui::Tests::Engine
             return elem;
         }
 
+        Nui::val createStyleDeclaration()
+        {
+            // Properties are stored directly on the declaration object under their css name.
+            auto style = Nui::val::object();
+            style.set("setPropertyCalls", int{0});
+            style.set(
+                "setProperty",
+                Function{
+                    [self = style](Nui::val name, Nui::val value) -> Nui::val {
+                        self.set(name.template as<std::string>(), *value.handle());
+                        self.set("setPropertyCalls", self["setPropertyCalls"].template as<long long>() + 1);
+                        return Nui::val::undefined();
+                    },
+                });
+            style.set(
+                "removeProperty",
+                Function{
+                    [self = style](Nui::val name) -> Nui::val {
+                        auto declaration = self;
+                        declaration.delete_(name.template as<std::string>());
+                        return Nui::val::undefined();
+                    },
+                });
+            return style;
+        }
+
+        Nui::val createClassList()
+        {
+            // Tokens are stored as keys of the "tokens" object.
+            auto classList = Nui::val::object();
+            classList.set("tokens", Nui::val::object());
+            classList.set("mutations", int{0});
+            classList.set(
+                "add",
+                Function{
+                    [self = classList](Nui::val token) -> Nui::val {
+                        self["tokens"].set(token.template as<std::string>(), true);
+                        self.set("mutations", self["mutations"].template as<long long>() + 1);
+                        return Nui::val::undefined();
+                    },
+                });
+            classList.set(
+                "remove",
+                Function{
+                    [self = classList](Nui::val token) -> Nui::val {
+                        self["tokens"].delete_(token.template as<std::string>());
+                        self.set("mutations", self["mutations"].template as<long long>() + 1);
+                        return Nui::val::undefined();
+                    },
+                });
+            classList.set(
+                "contains",
+                Function{
+                    [self = classList](Nui::val token) -> Nui::val {
+                        return Nui::val{self["tokens"].hasOwnProperty(token.template as<std::string>().c_str())};
+                    },
+                });
+            return classList;
+        }
+
         Nui::val createElement(Nui::val tag)
         {
             auto elem = createBasicElement(tag);
             elem.set("nodeType", int{1});
+            elem.set("style", createStyleDeclaration());
+            elem.set("classList", createClassList());
+            elem.set("listeners", Nui::val::object());
+            elem.set("listenerOptions", Nui::val::object());
+            elem.set(
+                "addEventListener",
+                Function{
+                    [self = elem](Nui::val type, Nui::val listener, Nui::val options) -> Nui::val {
+                        self["listeners"].set(type.template as<std::string>(), listener);
+                        self["listenerOptions"].set(type.template as<std::string>(), options);
+                        return Nui::val::undefined();
+                    },
+                });
             elem.set(
                 "appendChild",
                 Function{
@@ -151,8 +224,8 @@ namespace Nui::Tests::Engine
                             if (it != container.end())
                                 container.erase(it);
                         };
-                        eraseIt(value["children"].template as<Array&>());
-                        eraseIt(value["childNodes"].template as<Array&>());
+                        eraseIt(self["children"].template as<Array&>());
+                        eraseIt(self["childNodes"].template as<Array&>());
                         return Nui::val::undefined();
                     },
                 });
@@ -143,6 +143,14 @@ namespace Nui::Tests::Engine
         {
             return std::any_cast<T const&>(value_);
         }
+        /// Converts numbers that are not stored as long long or long double, e.g. ids held as int.
+        template <typename T>
+        T asNumber() const
+        {
+            if (isInteger_)
+                return static_cast<T>(std::any_cast<long long>(value_));
+            return static_cast<T>(std::any_cast<long double>(value_));
+        }
         template <typename T>
         T as() &&
         {
@@ -9,6 +9,7 @@
 
 #include <nui/frontend/elements.hpp>
 #include <nui/frontend/attributes.hpp>
+#include <nui/frontend/utility/css_variables.hpp>
 
 namespace Nui::Tests
 {
@@ -148,6 +149,30 @@ namespace Nui::Tests
         EXPECT_EQ(Nui::val::global("document")["body"]["attributes"]["id"].as<std::string>(), "qwer");
     }
 
+    TEST_F(TestAttributes, StaticAttributePackIsAppliedWithDynamicAttributes)
+    {
+        using Nui::Elements::div;
+        using Nui::Attributes::class_;
+        using Nui::Attributes::id;
+        using namespace Nui::Attributes::Literals;
+
+        static constexpr auto cardAttributes = staticAttributes(class_ = "card", "role"_attr = "listitem");
+        static_assert(std::is_same_v<decltype(id = "qwer"), StaticAttribute>);
+
+        Observed<std::string> observedId{"asdf"};
+
+        render(div{attributePack<cardAttributes>, id = observedId}());
+
+        auto attributes = Nui::val::global("document")["body"]["attributes"];
+        EXPECT_EQ(attributes["class"].as<std::string>(), "card");
+        EXPECT_EQ(attributes["role"].as<std::string>(), "listitem");
+        EXPECT_EQ(attributes["id"].as<std::string>(), "asdf");
+
+        observedId = "qwer";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(attributes["id"].as<std::string>(), "qwer");
+    }
+
     TEST_F(TestAttributes, ChangeInObservedValueOnlyChangesRelatedAttribute)
     {
         using Nui::Elements::div;
@@ -276,6 +301,98 @@ namespace Nui::Tests
         EXPECT_EQ(Nui::val::global("document")["body"]["attributes"]["style"].as<std::string>(), "color: blue");
     }
 
+    TEST_F(TestAttributes, StylePropertiesAreSetIndividually)
+    {
+        using Nui::Elements::div;
+        using namespace Nui::Attributes::Literals;
+
+        Observed<std::string> transform{"rotate(0deg)"};
+        Observed<double> opacity{0.5};
+        render(div{"transform"_style = transform, "opacity"_style = opacity, "color"_style = "red"}());
+
+        auto style = Nui::val::global("document")["body"]["style"];
+        EXPECT_EQ(style["transform"].as<std::string>(), "rotate(0deg)");
+        EXPECT_EQ(style["opacity"].as<long double>(), 0.5);
+        EXPECT_EQ(style["color"].as<std::string>(), "red");
+        EXPECT_EQ(style["setPropertyCalls"].as<long long>(), 3);
+
+        transform = "rotate(90deg)";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(style["transform"].as<std::string>(), "rotate(90deg)");
+        EXPECT_EQ(style["setPropertyCalls"].as<long long>(), 4);
+
+        transform = "";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_FALSE(style.hasOwnProperty("transform"));
+        EXPECT_EQ(style["opacity"].as<long double>(), 0.5);
+    }
+
+    TEST_F(TestAttributes, CssVariableIsSetOnRoot)
+    {
+        using Nui::Elements::div;
+
+        render(div{}());
+        auto root = Nui::val::global("document")["body"];
+
+        Observed<std::string> accent{"red"};
+        {
+            auto binding = bindCssVariable(accent, "accent", root);
+            EXPECT_EQ(root["style"]["--accent"].as<std::string>(), "red");
+
+            accent = "blue";
+            globalEventContext.executeActiveEventsImmediately();
+            EXPECT_EQ(root["style"]["--accent"].as<std::string>(), "blue");
+            EXPECT_EQ(root["style"]["setPropertyCalls"].as<long long>(), 2);
+        }
+
+        accent = "green";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(root["style"]["--accent"].as<std::string>(), "blue");
+    }
+
+    TEST_F(TestAttributes, ClassTokenTogglesOnlyItsClass)
+    {
+        using Nui::Elements::div;
+        using Nui::Attributes::class_;
+        using namespace Nui::Attributes::Literals;
+
+        Observed<bool> selected{false};
+        render(div{class_ = "row", "selected"_class = selected}());
+
+        auto classList = Nui::val::global("document")["body"]["classList"];
+        EXPECT_FALSE(classList["tokens"].hasOwnProperty("selected"));
+
+        selected = true;
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_TRUE(classList["tokens"].hasOwnProperty("selected"));
+        EXPECT_EQ(Nui::val::global("document")["body"]["attributes"]["class"].as<std::string>(), "row");
+
+        selected = false;
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_FALSE(classList["tokens"].hasOwnProperty("selected"));
+    }
+
+    TEST_F(TestAttributes, ClassListOnlyAppliesChangedTokens)
+    {
+        using Nui::Elements::div;
+        using Nui::Attributes::classList;
+
+        Observed<std::vector<std::string>> classes{{"a", "b"}};
+        render(div{classList = classes}());
+
+        auto domClassList = Nui::val::global("document")["body"]["classList"];
+        EXPECT_TRUE(domClassList["tokens"].hasOwnProperty("a"));
+        EXPECT_TRUE(domClassList["tokens"].hasOwnProperty("b"));
+        EXPECT_EQ(domClassList["mutations"].as<long long>(), 2);
+
+        classes = std::vector<std::string>{"b", "c"};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_FALSE(domClassList["tokens"].hasOwnProperty("a"));
+        EXPECT_TRUE(domClassList["tokens"].hasOwnProperty("b"));
+        EXPECT_TRUE(domClassList["tokens"].hasOwnProperty("c"));
+        EXPECT_EQ(domClassList["mutations"].as<long long>(), 4);
+    }
+
     TEST_F(TestAttributes, EventIsCallable)
     {
         using Nui::Elements::div;
@@ -290,6 +407,81 @@ namespace Nui::Tests
         EXPECT_TRUE(clicked);
     }
 
+    TEST_F(TestAttributes, PerFrameEventDeliversLatestEventOncePerFrame)
+    {
+        using Nui::Elements::div;
+        using namespace Nui::Attributes::Literals;
+
+        std::vector<Nui::val> frames;
+        globalObject.emplace("requestAnimationFrame", Function{[&frames](Nui::val callback) -> Nui::val {
+                                 frames.push_back(callback);
+                                 return Nui::val::undefined();
+                             }});
+
+        std::vector<long long> delivered;
+        render(div{"scroll"_event.perFrame(
+            [&delivered](Nui::val event) {
+                delivered.push_back(event["n"].as<long long>());
+            },
+            {.passive = true})}());
+
+        auto body = Nui::val::global("document")["body"];
+        EXPECT_TRUE(body["listenerOptions"]["scroll"]["passive"].as<bool>());
+
+        auto dispatch = [&body](long long n) {
+            auto event = Nui::val::object();
+            event.set("n", n);
+            body["listeners"]["scroll"](event);
+        };
+        dispatch(1);
+        dispatch(2);
+        dispatch(3);
+        ASSERT_EQ(frames.size(), 1);
+        EXPECT_TRUE(delivered.empty());
+
+        frames[0](Nui::val::undefined());
+        EXPECT_EQ(delivered, std::vector<long long>{3});
+
+        dispatch(4);
+        ASSERT_EQ(frames.size(), 2);
+        frames[1](Nui::val::undefined());
+        EXPECT_EQ(delivered, (std::vector<long long>{3, 4}));
+    }
+
+    TEST_F(TestAttributes, AccumulatePerFrameFoldsEvents)
+    {
+        using Nui::Elements::div;
+        using namespace Nui::Attributes::Literals;
+
+        std::vector<Nui::val> frames;
+        globalObject.emplace("requestAnimationFrame", Function{[&frames](Nui::val callback) -> Nui::val {
+                                 frames.push_back(callback);
+                                 return Nui::val::undefined();
+                             }});
+
+        long long total = 0;
+        render(div{"wheel"_event.accumulatePerFrame(
+            0ll,
+            [](long long& sum, Nui::val event) {
+                sum += event["deltaY"].as<long long>();
+            },
+            [&total](long long sum) {
+                total = sum;
+            })}());
+
+        auto body = Nui::val::global("document")["body"];
+        for (long long delta : {5, 7, -2})
+        {
+            auto event = Nui::val::object();
+            event.set("deltaY", delta);
+            body["listeners"]["wheel"](event);
+        }
+        ASSERT_EQ(frames.size(), 1);
+        frames[0](Nui::val::undefined());
+        EXPECT_EQ(total, 10);
+        EXPECT_FALSE(body["listenerOptions"]["wheel"]["passive"].as<bool>());
+    }
+
     TEST_F(TestAttributes, EventIsCallableWithEvent)
     {
         using Nui::Elements::div;
@@ -10,6 +10,10 @@
 #include <nui/event_system/event_context.hpp>
 #include <nui/event_system/observed_value.hpp>
 #include <nui/event_system/listen.hpp>
+#include <nui/event_system/transaction.hpp>
+
+#include <memory_resource>
+#include <vector>
 
 namespace Nui::Tests
 {
@@ -361,4 +365,229 @@ namespace Nui::Tests
 
         EXPECT_EQ(obs.value(), 50);
     }
+
+    TEST_F(TestEvents, TransactionDefersActivationUntilCommit)
+    {
+        Observed<int> obs;
+
+        int callCount = 0;
+        listen(obs, [&callCount](int const&) {
+            ++callCount;
+        });
+
+        {
+            Transaction transaction;
+            obs = 1;
+            obs = 2;
+            globalEventContext.executeActiveEventsImmediately();
+            EXPECT_EQ(callCount, 0);
+        }
+
+        EXPECT_EQ(callCount, 1);
+        EXPECT_EQ(obs.value(), 2);
+    }
+
+    TEST_F(TestEvents, TransactionActivatesEachObservedOnce)
+    {
+        Observed<int> first;
+        Observed<std::string> second;
+
+        int firstCalls = 0;
+        int secondCalls = 0;
+        listen(first, [&firstCalls](int const&) {
+            ++firstCalls;
+        });
+        listen(second, [&secondCalls](std::string const&) {
+            ++secondCalls;
+        });
+
+        transaction([&] {
+            for (int i = 0; i != 10; ++i)
+            {
+                first = i;
+                second = std::to_string(i);
+            }
+        });
+        globalEventContext.executeActiveEventsImmediately();
+
+        EXPECT_EQ(firstCalls, 1);
+        EXPECT_EQ(secondCalls, 1);
+        EXPECT_EQ(second.value(), "9");
+    }
+
+    TEST_F(TestEvents, NestedTransactionsCommitWithOutermost)
+    {
+        Observed<int> obs;
+
+        int calledWith = 0;
+        listen(obs, [&calledWith](int const& value) {
+            calledWith = value;
+        });
+
+        transaction([&] {
+            transaction([&] {
+                obs.modifyNow().value() = 5;
+            });
+            EXPECT_EQ(calledWith, 0);
+        });
+
+        EXPECT_EQ(calledWith, 5);
+    }
+
+    TEST_F(TestEvents, ObservedDestroyedWithinTransactionIsNotUpdated)
+    {
+        Observed<int> survivor;
+
+        int callCount = 0;
+        listen(survivor, [&callCount](int const&) {
+            ++callCount;
+        });
+
+        transaction([&] {
+            auto doomed = std::make_unique<Observed<int>>();
+            *doomed = 1;
+            survivor = 2;
+            doomed.reset();
+        });
+        globalEventContext.executeActiveEventsImmediately();
+
+        EXPECT_EQ(callCount, 1);
+    }
+
+    TEST_F(TestEvents, TransactionReturnsResult)
+    {
+        Observed<int> obs;
+        auto const result = transaction([&] {
+            obs = 3;
+            return obs.value() * 2;
+        });
+        EXPECT_EQ(result, 6);
+    }
+
+    TEST_F(TestEvents, ManyListenersCanBeDetachedInAnyOrder)
+    {
+        Observed<int> obs;
+
+        int callCount = 0;
+        std::vector<ListenRemover<Observed<int>>> removers;
+        for (int i = 0; i != 100; ++i)
+        {
+            removers.push_back(smartListen(obs, [&callCount](int const&) {
+                ++callCount;
+            }));
+        }
+        EXPECT_EQ(obs.attachedEventCount(), 100);
+
+        for (std::size_t i = 0; i < removers.size(); i += 2)
+            removers[i].removeEvent();
+        EXPECT_EQ(obs.attachedEventCount(), 50);
+
+        obs = 1;
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(callCount, 50);
+    }
+
+    TEST_F(TestEvents, IncrementalCleanupRemovesInvalidEventsInSlices)
+    {
+        constexpr std::size_t eventCount = 20;
+        std::vector<bool> alive(eventCount, true);
+        std::vector<bool> called(eventCount, false);
+        std::vector<EventContext::EventIdType> ids;
+        for (std::size_t i = 0; i != eventCount; ++i)
+        {
+            ids.push_back(globalEventContext.registerEvent(Event{
+                [&called, i](auto) {
+                    called[i] = true;
+                    return true;
+                },
+                [&alive, i]() {
+                    return static_cast<bool>(alive[i]);
+                }}));
+        }
+        auto const registeredEvents = [&]() {
+            called.assign(eventCount, false);
+            for (auto const id : ids)
+                globalEventContext.activateEvent(id);
+            globalEventContext.executeActiveEventsImmediately();
+            return called;
+        };
+
+        for (std::size_t i = 0; i < eventCount; i += 2)
+            alive[i] = false;
+
+        EXPECT_FALSE(globalEventContext.cleanInvalidEvents(7));
+        auto remaining = registeredEvents();
+        EXPECT_FALSE(remaining[0]);
+        EXPECT_TRUE(remaining[1]);
+        EXPECT_TRUE(remaining[8]);
+
+        // invalidated while the sweep is running:
+        alive[1] = false;
+
+        EXPECT_FALSE(globalEventContext.cleanInvalidEvents(7));
+        EXPECT_TRUE(globalEventContext.cleanInvalidEvents(7));
+        remaining = registeredEvents();
+        EXPECT_TRUE(remaining[1]);
+        for (std::size_t i = 2; i < eventCount; ++i)
+            EXPECT_EQ(remaining[i], static_cast<bool>(alive[i])) << i;
+
+        // the next pass starts at the beginning again:
+        EXPECT_TRUE(globalEventContext.cleanInvalidEvents(eventCount));
+        EXPECT_FALSE(registeredEvents()[1]);
+    }
+
+    TEST_F(TestEvents, CleanupBudgetPerExecutionRemovesInvalidEvents)
+    {
+        bool alive = true;
+        int calls = 0;
+        auto const id = globalEventContext.registerEvent(Event{
+            [&calls](auto) {
+                ++calls;
+                return true;
+            },
+            [&alive]() {
+                return alive;
+            }});
+
+        globalEventContext.setCleanupBudgetPerExecution(10);
+        alive = false;
+        globalEventContext.executeActiveEventsImmediately();
+        globalEventContext.setCleanupBudgetPerExecution(0);
+
+        globalEventContext.activateEvent(id);
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(calls, 0);
+    }
+
+    TEST_F(TestEvents, FrameArenaIsReleasedWhenTheOutermostScopeIsLeft)
+    {
+        std::vector<void const*> allocations;
+
+        auto allocate = [&](std::size_t count) {
+            std::pmr::vector<int> temporary{globalEventContext.frameArena().resource()};
+            temporary.assign(count, 0);
+            allocations.push_back(temporary.data());
+        };
+
+        {
+            FrameArena::Scope outer{globalEventContext.frameArena()};
+            allocate(16);
+            {
+                FrameArena::Scope inner{globalEventContext.frameArena()};
+                allocate(16);
+            }
+            allocate(16);
+        }
+        {
+            FrameArena::Scope scope{globalEventContext.frameArena()};
+            allocate(32);
+        }
+
+        ASSERT_EQ(allocations.size(), 4);
+        // Leaving the inner scope does not release what the outer one still uses.
+        EXPECT_NE(allocations[0], allocations[1]);
+        EXPECT_NE(allocations[1], allocations[2]);
+        // The buffer is reused by the next scope.
+        EXPECT_EQ(allocations[0], allocations[3]);
+    }
 }
\ No newline at end of file
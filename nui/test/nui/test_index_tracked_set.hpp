@@ -0,0 +1,75 @@
+#pragma once
+
+#include <nui/data_structures/index_tracked_set.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Nui::Tests
+{
+    TEST(IndexTrackedSet, InsertedValuesAreContainedOnce)
+    {
+        IndexTrackedSet<std::size_t> set;
+        EXPECT_TRUE(set.insert(1));
+        EXPECT_TRUE(set.insert(2));
+        EXPECT_FALSE(set.insert(1));
+
+        EXPECT_EQ(set.size(), 2);
+        EXPECT_TRUE(set.contains(1));
+        EXPECT_TRUE(set.contains(2));
+        EXPECT_FALSE(set.contains(3));
+    }
+
+    TEST(IndexTrackedSet, EraseRemovesOnlyGivenValue)
+    {
+        IndexTrackedSet<std::size_t> set;
+        for (std::size_t i = 0; i != 5; ++i)
+            set.insert(i);
+
+        EXPECT_TRUE(set.erase(1));
+        EXPECT_FALSE(set.erase(1));
+
+        std::vector<std::size_t> remaining{set.begin(), set.end()};
+        std::sort(remaining.begin(), remaining.end());
+        EXPECT_EQ(remaining, (std::vector<std::size_t>{0, 2, 3, 4}));
+    }
+
+    TEST(IndexTrackedSet, StaysConsistentAcrossIndexThreshold)
+    {
+        constexpr std::size_t count = IndexTrackedSet<std::size_t>::indexThreshold * 4;
+
+        IndexTrackedSet<std::size_t> set;
+        for (std::size_t i = 0; i != count; ++i)
+            EXPECT_TRUE(set.insert(i));
+        EXPECT_FALSE(set.insert(count / 2));
+
+        for (std::size_t i = 0; i != count; i += 2)
+            EXPECT_TRUE(set.erase(i));
+
+        EXPECT_EQ(set.size(), count / 2);
+        for (std::size_t i = 0; i != count; ++i)
+            EXPECT_EQ(set.contains(i), i % 2 == 1);
+
+        for (std::size_t i = 1; i < count; i += 2)
+            EXPECT_TRUE(set.erase(i));
+        EXPECT_TRUE(set.empty());
+    }
+
+    TEST(IndexTrackedSet, EraseIfRemovesMatchingValues)
+    {
+        IndexTrackedSet<std::size_t> set;
+        for (std::size_t i = 0; i != 40; ++i)
+            set.insert(i);
+
+        EXPECT_EQ(set.eraseIf([](std::size_t value) {
+            return value % 3 == 0;
+        }),
+                  14);
+        EXPECT_EQ(set.size(), 26);
+        EXPECT_FALSE(set.contains(39));
+        EXPECT_TRUE(set.contains(38));
+    }
+}
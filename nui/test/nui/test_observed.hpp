@@ -9,6 +9,19 @@
 
 #include <nui/frontend/elements.hpp>
 #include <nui/frontend/attributes.hpp>
+#include <nui/event_system/tags_traits/track_member_changes.hpp>
+
+namespace Nui::Tests
+{
+    struct TrackedPerson
+    {
+        std::string name;
+        int age;
+
+        bool operator==(TrackedPerson const&) const = default;
+    };
+    BOOST_DESCRIBE_STRUCT(TrackedPerson, (), (name, age))
+}
 
 namespace Nui::Tests
 {
@@ -125,4 +138,116 @@ namespace Nui::Tests
 
         EXPECT_EQ(**copy, 1);
     }
+
+    TEST_F(TestObserved, UnchangedAssignmentIsSuppressedWithTag)
+    {
+        Observed<std::string, SuppressUnchanged> observed{"a"};
+        Observed<std::vector<int>, SuppressUnchanged> container{{1, 2}};
+
+        int calls = 0;
+        listen(observed, [&calls](std::string const&) {
+            ++calls;
+        });
+        listen(container, [&calls](std::vector<int> const&) {
+            ++calls;
+        });
+
+        observed = std::string{"a"};
+        container = std::vector<int>{1, 2};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(calls, 0);
+
+        observed = std::string{"b"};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(calls, 1);
+    }
+
+    TEST_F(TestObserved, UnchangedAssignmentIsNotSuppressedByDefault)
+    {
+        Observed<std::string> observed{"a"};
+
+        int calls = 0;
+        listen(observed, [&calls](std::string const&) {
+            ++calls;
+        });
+
+        observed = std::string{"a"};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(calls, 1);
+    }
+
+    TEST_F(TestObserved, MemberChangesAreTracked)
+    {
+        Observed<TrackedPerson, TrackMemberChanges> person{TrackedPerson{"Alice", 30}};
+
+        int nameCalls = 0;
+        int ageCalls = 0;
+        listenMember(person, &TrackedPerson::name, [&nameCalls](std::string const&) {
+            ++nameCalls;
+        });
+        listenMember(person, &TrackedPerson::age, [&ageCalls](int) {
+            ++ageCalls;
+        });
+
+        person = TrackedPerson{"Alice", 30};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 0);
+        EXPECT_EQ(ageCalls, 0);
+
+        person = TrackedPerson{"Alice", 31};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 0);
+        EXPECT_EQ(ageCalls, 1);
+        EXPECT_TRUE(person.memberChanged(&TrackedPerson::age));
+        EXPECT_FALSE(person.memberChanged(&TrackedPerson::name));
+
+        // changes between two executions accumulate:
+        person = TrackedPerson{"Bob", 31};
+        person = TrackedPerson{"Bob", 32};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 1);
+        EXPECT_EQ(ageCalls, 2);
+
+        person.modify()->name = "Carol";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 2);
+        EXPECT_EQ(ageCalls, 3);
+    }
+
+    TEST_F(TestObserved, UndiffedUpdatesMarkAllMembersChanged)
+    {
+        Observed<TrackedPerson, TrackMemberChanges> person{TrackedPerson{"Alice", 30}};
+
+        int nameCalls = 0;
+        int ageCalls = 0;
+        listenMember(person, &TrackedPerson::name, [&nameCalls](std::string const&) {
+            ++nameCalls;
+        });
+        listenMember(person, &TrackedPerson::age, [&ageCalls](int) {
+            ++ageCalls;
+        });
+
+        person = TrackedPerson{"Alice", 31};
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 0);
+        EXPECT_EQ(ageCalls, 1);
+
+        person.assignChecked(TrackedPerson{"Bob", 31});
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_TRUE(person.memberChanged(&TrackedPerson::name));
+        EXPECT_EQ(nameCalls, 1);
+
+        person.value().name = "Carol";
+        person.update();
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_TRUE(person.memberChanged(&TrackedPerson::name));
+        EXPECT_EQ(nameCalls, 2);
+
+        // an undiffed change accumulates with a diffed one before the next execution:
+        person = TrackedPerson{"Carol", 32};
+        person.assignChecked(TrackedPerson{"Dave", 32});
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(nameCalls, 3);
+        EXPECT_EQ(ageCalls, 4);
+    }
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "engine/global_object.hpp"
 #include "engine/document.hpp"
 
+#include <nui/event_system/transaction.hpp>
+
 #include <iostream>
 #include <vector>
 #include <string>
@@ -50,6 +52,52 @@ namespace Nui::Tests
         textBodyParityTest(vec, parent);
     }
 
+    TEST_F(TestRanges, ProgressiveRangeRendersRemainderInFrames)
+    {
+        using Nui::Elements::div;
+        using Nui::Elements::body;
+        using namespace Nui::Attributes;
+
+        std::vector<Nui::val> frames;
+        globalObject.emplace("requestAnimationFrame", Function{[&frames](Nui::val callback) -> Nui::val {
+                                 frames.push_back(callback);
+                                 return Nui::val::undefined();
+                             }});
+        auto runFrame = [&frames]() {
+            auto frame = frames.back();
+            frames.pop_back();
+            frame(Nui::val::undefined());
+        };
+
+        Nui::val parent;
+        Observed<std::vector<char>> vec{{'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H'}};
+
+        render(body{reference = parent}(
+            range(vec).progressive({.initialCount = 3, .chunkSize = 2, .frameBudget = 0}),
+            [](long long, auto const& element) {
+                return div{}(std::string{element});
+            }));
+        EXPECT_EQ(getChildrenBodyTextConcat(parent), "ABC");
+        ASSERT_EQ(frames.size(), 1);
+
+        runFrame();
+        EXPECT_EQ(getChildrenBodyTextConcat(parent), "ABCDE");
+
+        // Changes arriving mid-way apply to the rendered part, the rest is picked up by the next chunks.
+        vec.insert(vec.begin() + 1, 'X');
+        vec.erase(vec.begin() + 6);
+        globalEventContext.executeActiveEventsImmediately();
+
+        while (!frames.empty())
+            runFrame();
+        textBodyParityTest(vec, parent);
+
+        vec.push_back('Z');
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_TRUE(frames.empty());
+        textBodyParityTest(vec, parent);
+    }
+
     // range() over a shared_ptr<Observed<...>> must be reactive (stored as a weak_ptr
     // internally, locked per update). Reassigning the underlying Observed re-renders.
     TEST_F(TestRanges, SharedPtrObservedReassignmentUpdatesView)
@@ -3596,4 +3644,77 @@ namespace Nui::Tests
         EXPECT_EQ(parent["children"][0]["textContent"].as<std::string>(), "7");
         EXPECT_EQ(parent["children"][2]["textContent"].as<std::string>(), "9");
     }
+
+    TEST_F(TestRanges, TransactionWithMixedOperationsKeepsParity)
+    {
+        Nui::val parent;
+        Observed<std::vector<char>> vec{{'A', 'B', 'C', 'D'}};
+
+        rangeTextBodyRender(vec, parent);
+        textBodyParityTest(vec, parent);
+
+        transaction([&] {
+            vec.push_back('E');
+            vec[0] = 'X';
+            vec.erase(vec.begin() + 1);
+            vec.insert(vec.begin(), 'Y');
+            vec.pop_back();
+        });
+        globalEventContext.executeActiveEventsImmediately();
+        textBodyParityTest(vec, parent);
+    }
+
+    TEST_F(TestRanges, TransactionWithSameOperationTypeKeepsParity)
+    {
+        Nui::val parent;
+        Observed<std::vector<char>> vec{{'A', 'B', 'C', 'D'}};
+
+        rangeTextBodyRender(vec, parent);
+
+        transaction([&] {
+            for (std::size_t i = 0; i != vec.size(); ++i)
+                vec[i] = 'Z';
+        });
+        globalEventContext.executeActiveEventsImmediately();
+        textBodyParityTest(vec, parent);
+
+        transaction([&] {
+            vec.push_back('E');
+            vec.push_back('F');
+            vec.insert(vec.begin(), 'G');
+        });
+        globalEventContext.executeActiveEventsImmediately();
+        textBodyParityTest(vec, parent);
+    }
+
+    TEST_F(TestRanges, ReadViewDoesNotRerenderElements)
+    {
+        using Nui::Elements::div;
+        using Nui::Elements::body;
+        using namespace Nui::Attributes;
+
+        Nui::val parent;
+        Observed<std::vector<char>> vec{{'A', 'B', 'C', 'D'}};
+
+        int renderCount = 0;
+        render(body{reference = parent}(range(vec), [&renderCount](long long, auto const& element) {
+            ++renderCount;
+            return div{}(std::string{element});
+        }));
+        ASSERT_EQ(renderCount, 4);
+
+        std::string read;
+        for (auto const& element : vec.read())
+            read.push_back(element);
+        read.push_back(vec.read()[2]);
+        globalEventContext.executeActiveEventsImmediately();
+
+        EXPECT_EQ(read, "ABCDC");
+        EXPECT_EQ(renderCount, 4);
+
+        vec[1] = 'X';
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(renderCount, 5);
+        textBodyParityTest(vec, parent);
+    }
 }
\ No newline at end of file
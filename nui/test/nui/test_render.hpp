@@ -12,7 +12,12 @@
 #include <nui/frontend/svg_attributes.hpp>
 #include <nui/frontend/dom/reference.hpp>
 #include <nui/frontend/utility/stabilize.hpp>
+#include <nui/frontend/utility/lazy.hpp>
+#include <nui/frontend/utility/memo.hpp>
+#include <nui/frontend/utility/keep_alive.hpp>
 
+#include <map>
+#include <optional>
 #include <vector>
 #include <string>
 
@@ -410,6 +415,150 @@ namespace Nui::Tests
             Nui::val::global("document")["body"]["children"][0]["attributes"]["id"].as<std::string>(), "changed again");
     }
 
+    TEST_F(TestRender, LazyElementMaterializesNearViewport)
+    {
+        using Nui::Elements::div;
+        using Nui::Elements::span;
+        using namespace Nui::Attributes;
+
+        std::optional<Nui::val> intersectionCallback;
+        std::size_t observeCalls = 0;
+        globalObject.emplace("IntersectionObserver", Object{});
+        Nui::val::global("IntersectionObserver")
+            .set(
+                "constructor",
+                Function{[&intersectionCallback, &observeCalls](Nui::val callback, Nui::val) -> Nui::val {
+                    intersectionCallback = callback;
+                    auto observer = Nui::val::object();
+                    observer.set("observe", Function{[&observeCalls](Nui::val) -> Nui::val {
+                                     ++observeCalls;
+                                     return Nui::val::undefined();
+                                 }});
+                    observer.set("unobserve", Function{[](Nui::val) -> Nui::val {
+                                     return Nui::val::undefined();
+                                 }});
+                    observer.set("disconnect", Function{[]() -> Nui::val {
+                                     return Nui::val::undefined();
+                                 }});
+                    return observer;
+                }});
+        auto intersect = [&intersectionCallback](bool isIntersecting) {
+            auto entry = Nui::val::object();
+            entry.set("isIntersecting", isIntersecting);
+            auto entries = Nui::val::array();
+            entries.template as<Array&>().push_back(entry.handle());
+            (*intersectionCallback)(entries, Nui::val::undefined());
+        };
+
+        LazyElement lazyElement{{.dematerializeWhenHidden = true}};
+        render(div{}(lazy(lazyElement, span{id = "content"}())));
+
+        auto body = Nui::val::global("document")["body"];
+        ASSERT_TRUE(intersectionCallback);
+        EXPECT_EQ(observeCalls, 1);
+        EXPECT_FALSE(lazyElement.materialized());
+        EXPECT_EQ(body["children"][0]["tagName"].as<std::string>(), "div");
+
+        intersect(true);
+        EXPECT_TRUE(lazyElement.materialized());
+        EXPECT_EQ(body["children"][0]["tagName"].as<std::string>(), "span");
+        EXPECT_EQ(body["children"][0]["attributes"]["id"].as<std::string>(), "content");
+
+        intersect(false);
+        EXPECT_FALSE(lazyElement.materialized());
+        EXPECT_EQ(body["children"][0]["tagName"].as<std::string>(), "div");
+        EXPECT_EQ(observeCalls, 3);
+    }
+
+    TEST_F(TestRender, MemoReusesSubtreeWhileDependenciesAreEqual)
+    {
+        using Nui::Elements::div;
+        using Nui::Elements::span;
+        using namespace Nui::Attributes;
+
+        Nui::Observed<int> unrelated{0};
+        Nui::Observed<int> dependency{1};
+        MemoElement<int> memoElement;
+        int builds = 0;
+
+        render(div{}(observe(unrelated, dependency), [&]() -> Nui::ElementRenderer {
+            return memo(memoElement, dependency.value(), [&]() {
+                ++builds;
+                return span{id = std::to_string(dependency.value())}();
+            });
+        }));
+
+        auto body = Nui::val::global("document")["body"];
+        ASSERT_EQ(body["children"]["length"].as<long long>(), 1);
+        auto const firstSpan = body["children"][0];
+        EXPECT_EQ(builds, 1);
+
+        unrelated = 1;
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(body["children"]["length"].as<long long>(), 1);
+        EXPECT_EQ(*body["children"][0].handle(), *firstSpan.handle());
+        EXPECT_EQ(builds, 1);
+
+        dependency = 2;
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(body["children"]["length"].as<long long>(), 1);
+        EXPECT_EQ(body["children"][0]["attributes"]["id"].as<std::string>(), "2");
+        EXPECT_EQ(builds, 2);
+    }
+
+    TEST_F(TestRender, KeepAliveReattachesCachedViews)
+    {
+        using Nui::Elements::div;
+        using Nui::Elements::span;
+        using namespace Nui::Attributes;
+
+        std::vector<std::string> deactivated;
+        std::vector<std::string> evicted;
+        KeepAlive<std::string> pages{{
+            .capacity = 2,
+            .onDeactivate =
+                [&deactivated](std::string const& key) {
+                    deactivated.push_back(key);
+                },
+            .onEvict =
+                [&evicted](std::string const& key) {
+                    evicted.push_back(key);
+                },
+        }};
+        Nui::Observed<std::string> route{"a"};
+        std::map<std::string, int> builds;
+
+        render(div{}(observe(route), [&]() -> Nui::ElementRenderer {
+            return keepAlive(pages, route.value(), [&]() {
+                ++builds[route.value()];
+                return span{id = route.value()}();
+            });
+        }));
+
+        auto body = Nui::val::global("document")["body"];
+        auto const pageA = body["children"][0];
+
+        route = "b";
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(body["children"]["length"].as<long long>(), 1);
+        EXPECT_EQ(body["children"][0]["attributes"]["id"].as<std::string>(), "b");
+
+        route = "a";
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(body["children"]["length"].as<long long>(), 1);
+        EXPECT_EQ(*body["children"][0].handle(), *pageA.handle());
+        EXPECT_EQ(builds["a"], 1);
+        EXPECT_EQ(builds["b"], 1);
+        EXPECT_EQ(deactivated, (std::vector<std::string>{"a", "b"}));
+
+        route = "c";
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_EQ(evicted, std::vector<std::string>{"b"});
+        EXPECT_TRUE(pages.contains("a"));
+        EXPECT_FALSE(pages.contains("b"));
+        EXPECT_EQ(pages.size(), 2);
+    }
+
     TEST_F(TestRender, StableFragmentCreatesPhantomDiv)
     {
         using Nui::Elements::div;
@@ -0,0 +1,347 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "common_test_fixture.hpp"
+#include "engine/global_object.hpp"
+#include "engine/object.hpp"
+#include "engine/function.hpp"
+
+#include <nui/frontend/rpc_awaitable.hpp>
+#include <nui/frontend/rpc_stream_reader.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace Nui::Tests
+{
+    using namespace Engine;
+    using namespace std::string_literals;
+
+    struct TestRpcEntry
+    {
+        std::string name;
+        int size;
+        std::optional<std::string> owner;
+    };
+    BOOST_DESCRIBE_STRUCT(TestRpcEntry, (), (name, size, owner));
+
+    NUI_RPC(testEntryChanged, void(TestRpcEntry const& entry, int revision));
+    NUI_RPC(testListEntries, std::vector<TestRpcEntry>(std::string const& path));
+
+    class TestRpc : public CommonTestFixture
+    {
+      protected:
+        void SetUp() override
+        {
+            globalObject.emplace("globalThis", Object{});
+            Nui::val::global("globalThis").set("setTimeout", Function{[this](Nui::val callback, int) -> Nui::val {
+                                                   timeouts_.push_back(callback);
+                                                   return Nui::val::undefined();
+                                               }});
+            globalObject.emplace("nui_rpc", Object{});
+            auto rpc = Nui::val::global("nui_rpc");
+            rpc.set("request", Function{[this](Nui::val callback, int, Nui::val) -> Nui::val {
+                        pending_[++lastId_] = callback;
+                        return Nui::val{lastId_};
+                    }});
+            rpc.set("cancel", Function{[this](std::uint32_t id) -> Nui::val {
+                        return Nui::val{pending_.erase(static_cast<int>(id)) == 1};
+                    }});
+            rpc.set("backend", Nui::val::object());
+            rpc.set("frontend", Nui::val::object());
+            installStreamTable();
+        }
+
+        // Mirrors the stream table of the dispatcher script of the RpcHub.
+        void installStreamTable()
+        {
+            auto rpc = Nui::val::global("nui_rpc");
+            rpc.set("openStream", Function{[this](Nui::val onChunk, Nui::val onEnd) -> Nui::val {
+                        streams_[++lastStreamId_] = {onChunk, onEnd};
+                        return Nui::val{lastStreamId_};
+                    }});
+            rpc.set("closeStream", Function{[this](std::uint32_t id) -> Nui::val {
+                        return Nui::val{streams_.erase(static_cast<int>(id)) == 1};
+                    }});
+            rpc.set("isStreamOpen", Function{[this](std::uint32_t id) -> Nui::val {
+                        return Nui::val{streams_.contains(static_cast<int>(id))};
+                    }});
+            rpc["frontend"].set("Nui::streamChunk", Function{[this](Nui::val args) -> Nui::val {
+                                    if (auto iter = streams_.find(args[0].as<int>()); iter != streams_.end())
+                                        iter->second.first(args[1]);
+                                    return Nui::val::undefined();
+                                }});
+            rpc["frontend"].set("Nui::streamEnd", Function{[this](Nui::val args) -> Nui::val {
+                                    auto iter = streams_.find(args[0].as<int>());
+                                    if (iter == streams_.end())
+                                        return Nui::val::undefined();
+                                    auto onEnd = iter->second.second;
+                                    streams_.erase(iter);
+                                    onEnd(args[1]);
+                                    return Nui::val::undefined();
+                                }});
+        }
+
+        void addBackendFunction(std::string const& name)
+        {
+            Nui::val::global("nui_rpc")["backend"].set(name, Function{[this](Nui::val backChannel) -> Nui::val {
+                                                           backChannels_.push_back(backChannel.as<std::string>());
+                                                           return Nui::val::undefined();
+                                                       }});
+        }
+
+        void recordBackendCalls(std::string const& name, std::size_t arity)
+        {
+            auto record = [this, name](std::vector<Nui::val> args) {
+                backendCalls_.emplace_back(name, std::move(args));
+                return Nui::val::undefined();
+            };
+            auto backend = Nui::val::global("nui_rpc")["backend"];
+            if (arity == 1)
+                backend.set(name, Function{[record](Nui::val a) -> Nui::val {
+                                return record({a});
+                            }});
+            else if (arity == 2)
+                backend.set(name, Function{[record](Nui::val a, Nui::val b) -> Nui::val {
+                                return record({a, b});
+                            }});
+            else
+                backend.set(name, Function{[record](Nui::val a, Nui::val b, Nui::val c) -> Nui::val {
+                                return record({a, b, c});
+                            }});
+        }
+
+        static Nui::val makeArray(std::vector<Nui::val> const& elements)
+        {
+            auto array = Nui::val::array();
+            for (auto const& element : elements)
+                array.template as<Array&>().push_back(element.handle());
+            return array;
+        }
+
+        void callFrontend(std::string const& name, std::vector<Nui::val> const& args)
+        {
+            Nui::val::global("nui_rpc")["frontend"][name.c_str()](makeArray(args));
+        }
+
+        void reply(int id, Nui::val value)
+        {
+            auto callback = pending_.at(id);
+            pending_.erase(id);
+            callback(value);
+        }
+
+        void runTimeouts()
+        {
+            while (!timeouts_.empty())
+            {
+                auto callback = timeouts_.front();
+                timeouts_.erase(timeouts_.begin());
+                callback();
+            }
+        }
+
+      protected:
+        std::vector<Nui::val> timeouts_{};
+        std::map<int, Nui::val> pending_{};
+        std::map<int, std::pair<Nui::val, Nui::val>> streams_{};
+        int lastStreamId_{0};
+        std::vector<std::string> backChannels_{};
+        std::vector<std::pair<std::string, std::vector<Nui::val>>> backendCalls_{};
+        int lastId_{0};
+    };
+
+    TEST_F(TestRpc, RequestsInWhenAllAreSentConcurrentlyAndResumeOnTheNextTurn)
+    {
+        addBackendFunction("getNumber");
+        addBackendFunction("getText");
+
+        std::optional<std::tuple<int, std::string>> result;
+        auto flow = [&result]() -> Task<> {
+            result = co_await whenAll(rpcRequest<int>("getNumber"), rpcRequest<std::string>("getText"));
+        };
+        auto task = flow();
+
+        EXPECT_EQ(backChannels_, (std::vector<std::string>{"reply_1", "reply_2"}));
+
+        reply(2, Nui::val{"text"s});
+        reply(1, Nui::val{42});
+        EXPECT_FALSE(task.done());
+        EXPECT_FALSE(result);
+
+        runTimeouts();
+        EXPECT_TRUE(task.done());
+        ASSERT_TRUE(result);
+        EXPECT_EQ(std::get<0>(*result), 42);
+        EXPECT_EQ(std::get<1>(*result), "text");
+    }
+
+    TEST_F(TestRpc, VoidRequestsInWhenAllYieldMonostate)
+    {
+        addBackendFunction("getNumber");
+        addBackendFunction("save");
+
+        std::optional<std::tuple<int, std::monostate>> result;
+        auto flow = [&result]() -> Task<> {
+            auto number = rpcRequest<int>("getNumber");
+            auto save = rpcRequest<void>("save");
+            result = co_await whenAll(std::move(number), std::move(save));
+        };
+        auto task = flow();
+
+        reply(1, Nui::val{42});
+        reply(2, Nui::val::undefined());
+        runTimeouts();
+        EXPECT_TRUE(task.done());
+        ASSERT_TRUE(result);
+        EXPECT_EQ(std::get<0>(*result), 42);
+    }
+
+    TEST_F(TestRpc, CancelledRequestThrowsInTheAwaitingTask)
+    {
+        addBackendFunction("getNumber");
+
+        auto request = rpcRequest<int>("getNumber");
+        bool cancelled = false;
+        auto flow = [&request, &cancelled]() -> Task<> {
+            try
+            {
+                co_await request;
+            }
+            catch (RpcRequestError const&)
+            {
+                cancelled = true;
+            }
+        };
+        auto task = flow();
+
+        EXPECT_TRUE(request.cancel());
+        EXPECT_FALSE(request.cancel());
+        runTimeouts();
+        EXPECT_TRUE(task.done());
+        EXPECT_TRUE(cancelled);
+        EXPECT_TRUE(pending_.empty());
+    }
+
+    TEST_F(TestRpc, StreamReaderGrantsCreditAsChunksAreProcessed)
+    {
+        recordBackendCalls("scanDirectory", 3);
+        recordBackendCalls("Nui::streamCredit", 2);
+
+        std::vector<std::string> chunks;
+        std::optional<std::optional<std::string>> end;
+        auto reader = RpcStreamReader::open(
+            "scanDirectory",
+            {.credit = 4},
+            [&chunks](std::string const& chunk) {
+                chunks.push_back(chunk);
+            },
+            [&end](std::optional<std::string> const& error) {
+                end = error;
+            },
+            "/home"s);
+
+        ASSERT_EQ(backendCalls_.size(), 1);
+        EXPECT_EQ(backendCalls_[0].second[0].as<long long>(), reader.id());
+        EXPECT_EQ(backendCalls_[0].second[1].as<long long>(), 4);
+        EXPECT_EQ(backendCalls_[0].second[2].as<std::string>(), "/home");
+
+        callFrontend("Nui::streamChunk", {Nui::val{reader.id()}, Nui::val{"a"s}});
+        EXPECT_EQ(backendCalls_.size(), 1);
+        callFrontend("Nui::streamChunk", {Nui::val{reader.id()}, Nui::val{"b"s}});
+        ASSERT_EQ(backendCalls_.size(), 2);
+        EXPECT_EQ(backendCalls_[1].first, "Nui::streamCredit");
+        EXPECT_EQ(backendCalls_[1].second[1].as<long long>(), 2);
+
+        callFrontend("Nui::streamEnd", {Nui::val{reader.id()}, Nui::val::null()});
+        EXPECT_EQ(chunks, (std::vector<std::string>{"a", "b"}));
+        ASSERT_TRUE(end);
+        EXPECT_FALSE(*end);
+        EXPECT_FALSE(reader.isOpen());
+    }
+
+    TEST_F(TestRpc, CancelledStreamReaderIgnoresChunksInFlight)
+    {
+        recordBackendCalls("scanDirectory", 2);
+        recordBackendCalls("Nui::streamCancel", 1);
+
+        int chunks = 0;
+        auto reader = RpcStreamReader::open(
+            "scanDirectory",
+            {},
+            [&chunks](Nui::val) {
+                ++chunks;
+            },
+            {});
+
+        EXPECT_TRUE(reader.cancel());
+        EXPECT_FALSE(reader.cancel());
+        ASSERT_EQ(backendCalls_.size(), 2);
+        EXPECT_EQ(backendCalls_[1].first, "Nui::streamCancel");
+
+        callFrontend("Nui::streamChunk", {Nui::val{reader.id()}, Nui::val{1}});
+        EXPECT_EQ(chunks, 0);
+    }
+
+    TEST_F(TestRpc, TypedCallSendsDescribedStructsAsArrays)
+    {
+        recordBackendCalls("testEntryChanged", 2);
+
+        RpcClient::call<testEntryChanged>(TestRpcEntry{.name = "a", .size = 3, .owner = std::nullopt}, 7);
+
+        ASSERT_EQ(backendCalls_.size(), 1);
+        auto entry = backendCalls_[0].second[0];
+        ASSERT_TRUE(entry.isArray());
+        EXPECT_EQ(entry[0].as<std::string>(), "a");
+        EXPECT_EQ(entry[1].as<long long>(), 3);
+        EXPECT_TRUE(entry[2].isNull());
+        EXPECT_EQ(backendCalls_[0].second[1].as<long long>(), 7);
+    }
+
+    TEST_F(TestRpc, TypedFunctionReadsArgumentsPositionally)
+    {
+        std::optional<TestRpcEntry> received;
+        int revision = 0;
+        RpcClient::registerFunction<testEntryChanged>([&](TestRpcEntry const& entry, int rev) {
+            received = entry;
+            revision = rev;
+        });
+
+        callFrontend(
+            "testEntryChanged", {makeArray({Nui::val{"b"s}, Nui::val{5}, Nui::val{"me"s}}), Nui::val{2}});
+
+        ASSERT_TRUE(received);
+        EXPECT_EQ(received->name, "b");
+        EXPECT_EQ(received->size, 5);
+        EXPECT_EQ(received->owner, "me");
+        EXPECT_EQ(revision, 2);
+    }
+
+    TEST_F(TestRpc, TypedRequestDecodesThePositionalResult)
+    {
+        recordBackendCalls("testListEntries", 2);
+
+        std::vector<TestRpcEntry> entries;
+        auto flow = [&entries]() -> Task<> {
+            entries = co_await rpcRequest<testListEntries>("/home"s);
+        };
+        auto task = flow();
+
+        ASSERT_EQ(backendCalls_.size(), 1);
+        EXPECT_EQ(backendCalls_[0].second[1].as<std::string>(), "/home");
+
+        reply(1, makeArray({makeArray({Nui::val{"c"s}, Nui::val{1}, Nui::val::null()})}));
+        runTimeouts();
+
+        EXPECT_TRUE(task.done());
+        ASSERT_EQ(entries.size(), 1);
+        EXPECT_EQ(entries[0].name, "c");
+        EXPECT_EQ(entries[0].size, 1);
+        EXPECT_FALSE(entries[0].owner);
+    }
+}
@@ -593,4 +593,34 @@ namespace Nui::Tests
 
         EXPECT_EQ(std::distance(registry.rawBegin(), registry.rawEnd()), idCount);
     }
+    TEST_F(TestSelectablesRegistry, EraseIfCountsEmptySlotsTowardsLimit)
+    {
+        constexpr auto idCount = 100;
+
+        std::vector<decltype(registry)::IdType> ids;
+        for (int i = 0; i != idCount; ++i)
+            ids.push_back(registry.emplace(std::to_string(i)));
+
+        // Selected items leave empty slots behind that are not condensed away.
+        for (int i = 0; i != idCount - 1; ++i)
+            registry.select(ids[i]);
+
+        int predicateCalls = 0;
+        const auto next = registry.eraseIf(ids.front(), 10, [&predicateCalls](BasicItem const&) {
+            ++predicateCalls;
+            return true;
+        });
+
+        EXPECT_EQ(next, ids[10]);
+        EXPECT_EQ(predicateCalls, 0);
+        EXPECT_EQ(registry.size(), 1);
+
+        const auto last = registry.eraseIf(next, idCount, [&predicateCalls](BasicItem const&) {
+            ++predicateCalls;
+            return true;
+        });
+        EXPECT_EQ(last, decltype(registry)::invalidId);
+        EXPECT_EQ(predicateCalls, 1);
+        EXPECT_EQ(registry.size(), 0);
+    }
 }
\ No newline at end of file
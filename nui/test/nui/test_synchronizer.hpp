@@ -0,0 +1,348 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "common_test_fixture.hpp"
+#include "engine/global_object.hpp"
+#include "engine/object.hpp"
+#include "engine/function.hpp"
+
+#include <nui/synchronizer.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Nui::Tests
+{
+    using namespace Engine;
+    using namespace std::string_literals;
+
+    class TestSynchronizer : public CommonTestFixture
+    {
+      protected:
+        void SetUp() override
+        {
+            globalObject.emplace("nui_rpc", Object{});
+            auto rpc = Nui::val::global("nui_rpc");
+            rpc.set("backend", Nui::val::object());
+            rpc.set("frontend", Nui::val::object());
+        }
+
+        /// Records the messages the synchronizer of the observed sends to the backend.
+        template <typename ObservedT>
+        void recordSent(ObservedT const& observed)
+        {
+            Nui::val::global("nui_rpc")["backend"].set(
+                ("observed_"s + std::string{syncId(observed)}).c_str(), Function{[this](Nui::val payload) -> Nui::val {
+                    sent_.push_back(payload);
+                    return Nui::val::undefined();
+                }});
+        }
+
+        /// Passes a message of the backend to the synchronizer of the observed.
+        template <typename ObservedT>
+        void receive(ObservedT const& observed, Nui::val const& payload)
+        {
+            Nui::val::global("nui_rpc")["frontend"][("observed_"s + std::string{syncId(observed)}).c_str()](payload);
+        }
+
+        static Nui::val makeDelta(RangeOperationType type, long low, long high, std::vector<int> const& values = {})
+        {
+            Nui::val range = Nui::val::object();
+            range.set("low", Nui::val{low});
+            range.set("high", Nui::val{high});
+            if (type != RangeOperationType::Erase)
+                range.set("values", convertToVal(values));
+            Nui::val ranges = Nui::val::array();
+            ranges.call<void>("push", range);
+
+            Nui::val payload = Nui::val::object();
+            payload.set("_rangeOperation", Nui::val{static_cast<int>(type)});
+            payload.set("ranges", ranges);
+            return payload;
+        }
+
+        static std::vector<int> toVector(Nui::val const& payload)
+        {
+            std::vector<int> result;
+            convertFromVal(payload, result);
+            return result;
+        }
+
+        /// Injected into a SyncSendGate instead of timers and animation frames.
+        Detail::SyncScheduler recordingScheduler()
+        {
+            return [this](std::optional<std::chrono::milliseconds> delay, std::function<void()> func) {
+                scheduled_.push_back({delay, std::move(func)});
+            };
+        }
+
+        void runScheduled()
+        {
+            auto scheduled = std::move(scheduled_);
+            scheduled_.clear();
+            for (auto const& [delay, func] : scheduled)
+                func();
+        }
+
+        std::shared_ptr<Detail::SyncSendGate<int>> makeGate(SynchronizerOptions const& options)
+        {
+            return std::make_shared<Detail::SyncSendGate<int>>(
+                options,
+                recordingScheduler(),
+                [this]() {
+                    return currentValue_;
+                },
+                [this](int const& payload) {
+                    gateSent_.push_back(payload);
+                });
+        }
+
+      protected:
+        std::vector<Nui::val> sent_{};
+        std::vector<std::pair<std::optional<std::chrono::milliseconds>, std::function<void()>>> scheduled_{};
+        std::vector<int> gateSent_{};
+        int currentValue_{0};
+    };
+
+    TEST_F(TestSynchronizer, TrackedRangesAreSentAsDeltasThatReproduceTheValue)
+    {
+        Observed<std::vector<int>, NUI_SYNCHRONIZE> local{{1, 2, 3, 4}};
+        Observed<std::vector<int>> remote{{1, 2, 3, 4}};
+        recordSent(local);
+        Synchronizer sync{local};
+
+        local.insert(local.begin() + 1, 9);
+        globalEventContext.executeActiveEventsImmediately();
+        local[3] = 7;
+        globalEventContext.executeActiveEventsImmediately();
+        local.erase(local.begin());
+        globalEventContext.executeActiveEventsImmediately();
+
+        ASSERT_EQ(sent_.size(), 3);
+        EXPECT_EQ(sent_[0]["_rangeOperation"].as<int>(), static_cast<int>(RangeOperationType::Insert));
+        EXPECT_EQ(sent_[1]["_rangeOperation"].as<int>(), static_cast<int>(RangeOperationType::Modify));
+        EXPECT_EQ(sent_[2]["_rangeOperation"].as<int>(), static_cast<int>(RangeOperationType::Erase));
+
+        for (auto const& payload : sent_)
+            EXPECT_TRUE(Detail::receiveSyncPayload(remote, payload));
+        EXPECT_EQ(remote.value(), (std::vector<int>{9, 2, 7, 4}));
+        EXPECT_EQ(remote.value(), local.value());
+    }
+
+    TEST_F(TestSynchronizer, DeltasOfTheOtherSideAreAppliedAndNotSentBack)
+    {
+        Observed<std::vector<int>, NUI_SYNCHRONIZE> local{{1, 2, 3}};
+        recordSent(local);
+        Synchronizer sync{local};
+
+        receive(local, makeDelta(RangeOperationType::Insert, 1, 2, {7, 8}));
+        EXPECT_EQ(local.value(), (std::vector<int>{1, 7, 8, 2, 3}));
+
+        receive(local, makeDelta(RangeOperationType::Modify, 4, 4, {9}));
+        EXPECT_EQ(local.value(), (std::vector<int>{1, 7, 8, 2, 9}));
+
+        receive(local, makeDelta(RangeOperationType::Erase, 0, 1));
+        EXPECT_EQ(local.value(), (std::vector<int>{8, 2, 9}));
+
+        EXPECT_TRUE(sent_.empty());
+    }
+
+    TEST_F(TestSynchronizer, RangesOutsideOfTheContainerAreRejected)
+    {
+        Observed<std::vector<int>> observed{{1, 2, 3}};
+
+        std::vector<Detail::SyncDeltaRange<int>> insert{{.low = 4, .high = 4, .values = {5}}};
+        EXPECT_FALSE(Detail::applySyncDelta(observed, RangeOperationType::Insert, insert));
+
+        std::vector<Detail::SyncDeltaRange<int>> modify{{.low = 2, .high = 3, .values = {5, 6}}};
+        EXPECT_FALSE(Detail::applySyncDelta(observed, RangeOperationType::Modify, modify));
+
+        std::vector<Detail::SyncDeltaRange<int>> erase{{.low = 1, .high = 3, .values = {}}};
+        EXPECT_FALSE(Detail::applySyncDelta(observed, RangeOperationType::Erase, erase));
+
+        EXPECT_EQ(observed.value(), (std::vector<int>{1, 2, 3}));
+    }
+
+    TEST_F(TestSynchronizer, RejectedDeltaFallsBackToTheWholeValue)
+    {
+        Observed<std::vector<int>, NUI_SYNCHRONIZE> local{{1, 2, 3}};
+        recordSent(local);
+        Synchronizer sync{local};
+
+        // The other side erased a range that this side already erased:
+        receive(local, makeDelta(RangeOperationType::Erase, 3, 4));
+        ASSERT_EQ(sent_.size(), 1);
+        EXPECT_TRUE(sent_[0].hasOwnProperty("_resync"));
+
+        receive(local, convertToVal(std::vector<int>{1, 2}));
+        EXPECT_EQ(local.value(), (std::vector<int>{1, 2}));
+        EXPECT_EQ(sent_.size(), 1);
+    }
+
+    TEST_F(TestSynchronizer, ResyncRequestIsAnsweredWithTheWholeValue)
+    {
+        Observed<std::vector<int>, NUI_SYNCHRONIZE> local{{1, 2, 3}};
+        recordSent(local);
+        Synchronizer sync{local};
+
+        receive(local, Detail::makeSyncResyncRequest());
+        ASSERT_EQ(sent_.size(), 1);
+        EXPECT_EQ(toVector(sent_[0]), (std::vector<int>{1, 2, 3}));
+    }
+
+    TEST_F(TestSynchronizer, SharedObservedContainerIsSynchronized)
+    {
+        auto local = std::make_shared<Observed<std::vector<int>, NUI_SYNCHRONIZE>>(std::vector<int>{1, 2, 3});
+        recordSent(*local);
+        Synchronizer sync{local};
+
+        local->push_back(4);
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(sent_.size(), 1);
+        EXPECT_EQ(sent_[0]["_rangeOperation"].as<int>(), static_cast<int>(RangeOperationType::Insert));
+
+        receive(*local, makeDelta(RangeOperationType::Modify, 0, 0, {9}));
+        EXPECT_EQ(local->value(), (std::vector<int>{9, 2, 3, 4}));
+        EXPECT_EQ(sent_.size(), 1);
+
+        receive(*local, makeDelta(RangeOperationType::Erase, 7, 7));
+        ASSERT_EQ(sent_.size(), 2);
+        EXPECT_TRUE(sent_[1].hasOwnProperty("_resync"));
+    }
+
+    TEST_F(TestSynchronizer, SharedObservedValueIsSynchronized)
+    {
+        auto local = std::make_shared<Observed<std::string, NUI_SYNCHRONIZE>>("a");
+        recordSent(*local);
+        Synchronizer sync{local};
+
+        *local = "b";
+        globalEventContext.executeActiveEventsImmediately();
+        ASSERT_EQ(sent_.size(), 1);
+        EXPECT_EQ(sent_[0].as<std::string>(), "b");
+
+        receive(*local, Nui::val{"c"s});
+        EXPECT_EQ(local->value(), "c");
+        EXPECT_EQ(sent_.size(), 1);
+    }
+
+    TEST_F(TestSynchronizer, LeadingEdgeSendsTheFirstChangeAndHoldsBackTheNext)
+    {
+        auto gate = makeGate({.minimumInterval = std::chrono::hours{1}, .leadingEdge = true});
+
+        gate->change(1);
+        EXPECT_EQ(gateSent_, (std::vector<int>{1}));
+        EXPECT_TRUE(scheduled_.empty());
+
+        gate->change(2);
+        EXPECT_EQ(gateSent_, (std::vector<int>{1}));
+        ASSERT_EQ(scheduled_.size(), 1);
+        ASSERT_TRUE(scheduled_[0].first);
+        EXPECT_GT(*scheduled_[0].first, std::chrono::milliseconds{0});
+        EXPECT_LE(*scheduled_[0].first, std::chrono::hours{1});
+
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{1, 2}));
+    }
+
+    TEST_F(TestSynchronizer, TrailingEdgeWaitsForTheInterval)
+    {
+        auto gate = makeGate({.minimumInterval = std::chrono::milliseconds{50}, .leadingEdge = false});
+
+        gate->change(1);
+        EXPECT_TRUE(gateSent_.empty());
+        ASSERT_EQ(scheduled_.size(), 1);
+        EXPECT_EQ(scheduled_[0].first, std::chrono::milliseconds{50});
+
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{1}));
+    }
+
+    TEST_F(TestSynchronizer, HeldBackChangesAreConflatedToTheCurrentValue)
+    {
+        auto gate = makeGate({.minimumInterval = std::chrono::milliseconds{50}, .leadingEdge = false});
+
+        currentValue_ = 5;
+        gate->change(1);
+        gate->change(2);
+        EXPECT_EQ(scheduled_.size(), 1);
+
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{5}));
+
+        // A single held back change is sent as it is again:
+        gate->change(3);
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{5, 3}));
+    }
+
+    TEST_F(TestSynchronizer, PerAnimationFrameSendsOncePerFrame)
+    {
+        auto gate = makeGate({.minimumInterval = std::chrono::hours{1}, .perAnimationFrame = true});
+
+        currentValue_ = 5;
+        gate->change(1);
+        gate->change(2);
+        EXPECT_TRUE(gateSent_.empty());
+        ASSERT_EQ(scheduled_.size(), 1);
+        EXPECT_FALSE(scheduled_[0].first);
+
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{5}));
+
+        gate->change(3);
+        ASSERT_EQ(scheduled_.size(), 1);
+        EXPECT_FALSE(scheduled_[0].first);
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{5, 3}));
+    }
+
+    TEST_F(TestSynchronizer, OtherSideChangeReplacesTheHeldBackChange)
+    {
+        auto gate = makeGate({.perAnimationFrame = true});
+
+        gate->otherSideChanged();
+        currentValue_ = 5;
+        gate->change(1);
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{1}));
+
+        gate->change(2);
+        gate->otherSideChanged();
+        runScheduled();
+        EXPECT_EQ(gateSent_, (std::vector<int>{1, 5}));
+    }
+
+    TEST_F(TestSynchronizer, RemoteChangeWhileADeltaIsHeldBackSendsTheWholeValue)
+    {
+        std::vector<Nui::val> frames;
+        globalObject.emplace("requestAnimationFrame", Function{[&frames](Nui::val callback) -> Nui::val {
+                                 frames.push_back(callback);
+                                 return Nui::val::undefined();
+                             }});
+
+        Observed<std::vector<int>, NUI_SYNCHRONIZE> local{{1, 2, 3}};
+        recordSent(local);
+        Synchronizer sync{local, {.perAnimationFrame = true}};
+
+        local.push_back(4);
+        globalEventContext.executeActiveEventsImmediately();
+        EXPECT_TRUE(sent_.empty());
+        ASSERT_EQ(frames.size(), 1);
+
+        // The held back insertion at 3 is at 4 after this:
+        receive(local, makeDelta(RangeOperationType::Insert, 0, 0, {0}));
+        EXPECT_EQ(local.value(), (std::vector<int>{0, 1, 2, 3, 4}));
+        EXPECT_TRUE(sent_.empty());
+
+        frames.back()(Nui::val::undefined());
+        ASSERT_EQ(sent_.size(), 1);
+        EXPECT_EQ(toVector(sent_[0]), (std::vector<int>{0, 1, 2, 3, 4}));
+    }
+}
@@ -7,11 +7,14 @@
 #include "test_observed.hpp"
 #include "test_elements.hpp"
 #include "test_selectables_registry.hpp"
+#include "test_index_tracked_set.hpp"
 #include "components/test_table.hpp"
 #include "components/test_dialog.hpp"
 #include "components/test_select.hpp"
 #include "test_delocalized.hpp"
 #include "test_synchronized.hpp"
+#include "test_rpc.hpp"
+#include "test_synchronizer.hpp"
 
 #include <gtest/gtest.h>
 